@@ -16,9 +16,41 @@ int lut_size;
 
 
 // 窗口参数
+int win_x;
+int win_y;
 int win_w;
 int win_h;
 
+// 屏RAM中是否保存着fb的内容. 屏断电后失效, 失效时只能发送整屏.
+int epd_ram_valid;
+
+// 当前窗口的RAM起始地址(已按镜像调整), 用于重写同一窗口.
+static int ram_x0;
+static int ram_y0;
+
+// 控制器状态, 见epd_init.
+#define EPD_ST_OFF    0  // 断电
+#define EPD_ST_SLEEP  1  // 深度休眠(0x10 0x01), 只保留RAM
+#define EPD_ST_IDLE   2  // 唤醒, 寄存器与RAM都保留
+static int epd_state;
+
+// 刷新完成后是否保持唤醒. 保持唤醒时下次刷新不用复位和初始化, 但待机电流更大.
+#ifndef EPD_KEEP_IDLE
+#define EPD_KEEP_IDLE  0
+#endif
+
+// 控制器中已经设置好的RAM窗口与LUT. 相同时不再重复发送.
+static RECT ram_win;
+static u8 *lut_loaded;
+static int lut_scale;
+
+// 三色屏上一次发送后红色平面是否有变化, 由epd_update消耗.
+static int red_changed;
+
+// 上次发送的每一行的hash(黑白与红两个平面), 用于比较新旧帧.
+#define EPD_MAX_LINES  296
+static u32 row_hash[EPD_MAX_LINES];
+
 
 /******************************************************************************/
 
@@ -120,22 +152,211 @@ u8 lut_fly_100[112] = {
     0x15, 0x41, 0xa8, 0x32, 0x50, 0x0f, 0x0c,
 };
 
-u8 *lut_fast = lut_fast_70;
-u8 *lut_fly  = lut_fly_70;
+// IL3895/SSD1673A没有OTP, 全刷也要写LUT. 格式: VS[20], TP[10].
+u8 lut_full_30[30] = {
+    0x22, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x01, 0x00,
+};
+
+u8 lut_fly_30[30] = {
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+
+// 按温度调整LUT中每个Group的相位长度(TP A-D, 重复次数不变). scale以16为1倍.
+// 上面的LUT按偏冷的条件调好, 温度高时缩短, 温度更低时加长.
+typedef struct {
+	signed char temp;  // 低于此温度(℃)时使用这一档
+	u8 scale;
+}LUT_BAND;
+
+static const LUT_BAND lut_bands[] = {
+	{  0, 32},
+	{ 10, 24},
+	{ 20, 16},
+	{ 30, 13},
+	{127, 11},
+};
+
+// 最近一次读到的屏内温度(℃), 与读数还能用的次数(按epd_update计)放在保留内存中.
+// 深度休眠唤醒后寄存器复位, 但温度读数还有效, 不用再读.
+int epd_temp __SECTION_ZERO("retention_mem_area0");
+static int temp_left __SECTION_ZERO("retention_mem_area0");
+#define EPD_TEMP_AGE  30
+
+static u8 lut_temp[112];
 
 
 /******************************************************************************/
 
+// 命令脚本. 格式: cmd, len, data[len], ..., SCRIPT_END. 由epd_script执行.
 
-// x必须是8的倍数，且x2>x1, Y2>y1
-void epd_window(int x1, int y1, int x2, int y2)
+#define B0(v)  ((v)&0xff)
+#define B1(v)  (((v)>>8)&0xff)
+
+
+// LUT的发送方式. 格式: cmd, len, offset, ..., SCRIPT_END. 由epd_script_lut执行.
+static const u8 lut_layout_70[] = {
+	0x32, 70,  0,   // LUT
+	0x03,  1, 70,   // VGH
+	0x04,  3, 71,   // VSH1 VSH2 VSL
+	0x3a,  1, 74,   // FR1
+	0x3b,  1, 75,   // FR2
+	SCRIPT_END,
+};
+
+static const u8 lut_layout_100[] = {
+	0x32, 100,   0, // LUT
+	0x03,   1, 100, // VGH
+	0x04,   3, 101, // VSH1 VSH2 VSL
+	0x2c,   1, 104, // VCOM
+	0x3a,   1, 105, // FR1
+	0x3b,   1, 106, // FR2
+	SCRIPT_END,
+};
+
+static const u8 lut_layout_30[] = {
+	0x32, 30, 0,    // LUT
+	SCRIPT_END,
+};
+
+
+#define SCRIPT_INIT_HEAD \
+	0x74, 1, 0x54, \
+	0x7e, 1, 0x3b, \
+	0x2b, 2, 0x04, 0x63, \
+	0x0c, 4, 0x8b, 0x9c, 0x96, 0x0f, \
+	0x3c, 1, 0x05   /* border wavefrom */
+
+#define SCRIPT_INIT_TAIL \
+	0x18, 1, 0x80   /* Read Built-in temperature sensor */
+
+// 全屏窗口, 与epd_window(0, 0, w-1, h-1)在无镜像时发送的内容相同.
+#define SCRIPT_WINDOW(w, h) \
+	0x0f, 2, 0xff, 0xff, \
+	0x01, 3, B0((h)-2), B1((h)-2), 0x00, \
+	0x11, 1, 0x03, \
+	0x44, 2, 0x00, ((w)-1)>>3, \
+	0x45, 4, 0x00, 0x00, B0((h)-1), B1((h)-1), \
+	0x4e, 1, 0x00, \
+	0x4f, 2, 0x00, 0x00
+
+#define SCRIPT_INIT(w, h) { SCRIPT_INIT_HEAD, SCRIPT_WINDOW(w, h), SCRIPT_INIT_TAIL, SCRIPT_END }
+
+static const u8 init_head[] = { SCRIPT_INIT_HEAD, SCRIPT_END };
+static const u8 init_tail[] = { SCRIPT_INIT_TAIL, SCRIPT_END };
+
+// IL3895/SSD1673A: 没有模拟块设置与温度传感器, VCOM与Gate时序要自己设.
+static const u8 init_head_3895[] = {
+	0x0c, 3, 0xd7, 0xd6, 0x9d,  // booster soft start
+	0x2c, 1, 0xa8,              // VCOM
+	0x3a, 1, 0x1a,              // dummy line
+	0x3b, 1, 0x08,              // gate line width
+	SCRIPT_END,
+};
+static const u8 init_tail_3895[] = { SCRIPT_END };
+
+static const u8 init_104x212[] = SCRIPT_INIT(104, 212);
+static const u8 init_122x250[] = SCRIPT_INIT(122, 250);
+static const u8 init_128x296[] = SCRIPT_INIT(128, 296);
+
+typedef struct {
+	u16 w;
+	u16 h;
+	const u8 *script;
+}INIT_SCRIPT;
+
+static const INIT_SCRIPT init_scripts[] = {
+	{104, 212, init_104x212},  // 2.13 BW
+	{122, 250, init_122x250},  // 2.13 BWR / OPM021B1
+	{128, 296, init_128x296},  // 2.90 BWR
+	{0, 0, NULL},
+};
+
+static const u8 *init_script;
+
+
+/******************************************************************************/
+
+// 控制器驱动. 由epd_detect根据LUT的长度识别.
+static EPD_DRV epd_drivers[] = {
+	{
+		.name       = "IL3897",
+		.lut_size   = 70,
+		.caps       = DRV_OTP | DRV_TEMP | DRV_OLD_RAM | DRV_PARTIAL | DRV_SCRIPT,
+		.groups     = 7,
+		.seq_full   = 0xf7,
+		.seq_lut    = 0xc7,
+		.init_head  = init_head,
+		.init_tail  = init_tail,
+		.lut_layout = lut_layout_70,
+		.lut_full   = NULL,
+		.lut_fast   = lut_fast_70,
+		.lut_fly    = lut_fly_70,
+	},
+	{
+		.name       = "SSD1675B",
+		.lut_size   = 100,
+		.caps       = DRV_OTP | DRV_TEMP | DRV_OLD_RAM | DRV_PARTIAL | DRV_SCRIPT,
+		.groups     = 10,
+		.seq_full   = 0xf7,
+		.seq_lut    = 0xc7,
+		.init_head  = init_head,
+		.init_tail  = init_tail,
+		.lut_layout = lut_layout_100,
+		.lut_full   = NULL,
+		.lut_fast   = lut_fast_100,
+		.lut_fly    = lut_fly_100,
+	},
+	{
+		.name       = "IL3895",
+		.lut_size   = 30,
+		.caps       = DRV_PARTIAL,
+		.groups     = 0,
+		.seq_full   = 0xc7,
+		.seq_lut    = 0xc7,
+		.init_head  = init_head_3895,
+		.init_tail  = init_tail_3895,
+		.lut_layout = lut_layout_30,
+		.lut_full   = lut_full_30,
+		.lut_fast   = lut_full_30,
+		.lut_fly    = lut_fly_30,
+	},
+};
+
+#define EPD_DRV_NUM  ((int)(sizeof(epd_drivers)/sizeof(EPD_DRV)))
+
+EPD_DRV *epd_drv = &epd_drivers[0];
+
+
+// 由epd_hw_init调用. 没有预编译脚本的屏(镜像或其它分辨率)在epd_init中现场生成窗口.
+void epd_select_script(void)
 {
-	int tmp;
+	const INIT_SCRIPT *sc;
 
-	x1 = x1&~0x07;
-	x2 = x2&~0x07;
-	win_w = x2-x1+8;
-	win_h = y2-y1+1;
+	init_script = NULL;
+	if(scr_mode&(MIRROR_H|MIRROR_V))
+		return;
+
+	for(sc=init_scripts; sc->w; sc++){
+		if(sc->w==scr_w && sc->h==scr_h){
+			init_script = sc->script;
+			break;
+		}
+	}
+}
+
+
+/******************************************************************************/
+
+
+static void epd_window_size(int w, int h)
+{
+	win_w = w;
+	win_h = h;
 
 	int rmode = scr_mode&3;
 	if(rmode==0 || rmode==2){
@@ -145,6 +366,19 @@ void epd_window(int x1, int y1, int x2, int y2)
 		fb_w = win_h;
 		fb_h = win_w;
 	}
+}
+
+
+// x必须是8的倍数，且x2>x1, Y2>y1
+void epd_window(int x1, int y1, int x2, int y2)
+{
+	int tmp;
+
+	x1 = x1&~0x07;
+	x2 = x2&~0x07;
+	win_x = x1;
+	win_y = y1;
+	epd_window_size(x2-x1+8, y2-y1+1);
 
 	//printk("epd_window: win: %d x %d  fb: %d x %d\n", win_w, win_h, fb_w, fb_h);
 	//printk("  [%d-%d] [%d-%d]\n", x1, x2, y1, y2);
@@ -163,29 +397,20 @@ void epd_window(int x1, int y1, int x2, int y2)
 
 	int xinc = (x2>x1)? 1: 0;
 	int yinc = (y2>y1)? 1: 0;
-
-	epd_cmd2(0x0f, y1-1, (y1-1)>>8);
-	epd_cmd3(0x01, y2-1, (y2-1)>>8, 0x00);  // Gate Driver output control
-
-	epd_cmd(0x11);  // data entry mode
-	epd_data((yinc<<1)|xinc);
-
-	epd_cmd(0x44);  // set Ram-X address start/end position
-	epd_data(x1>>3);
-	epd_data(x2>>3);
-
-	epd_cmd(0x45);  // set Ram-Y address start/end position
-	epd_data(y1&0xff);
-	epd_data(y1>>8);
-	epd_data(y2&0xff);
-	epd_data(y2>>8);
-
-	epd_cmd(0x4e);  // set RAM-x address
-	epd_data(x1>>3);
-	epd_cmd(0x4f);  // set RAM-y address
-	epd_data(y1&0xff);
-	epd_data(y1>>8);
-
+	ram_x0 = x1>>3;
+	ram_y0 = y1;
+
+	u8 script[] = {
+		0x0f, 2, B0(y1-1), B1(y1-1),
+		0x01, 3, B0(y2-1), B1(y2-1), 0x00,  // Gate Driver output control
+		0x11, 1, (yinc<<1)|xinc,            // data entry mode
+		0x44, 2, x1>>3, x2>>3,              // set Ram-X address start/end position
+		0x45, 4, B0(y1), B1(y1), B0(y2), B1(y2),  // set Ram-Y address start/end position
+		0x4e, 1, x1>>3,                     // set RAM-x address
+		0x4f, 2, B0(y1), B1(y1),            // set RAM-y address
+		SCRIPT_END,
+	};
+	epd_script(script);
 }
 
 
@@ -202,20 +427,7 @@ void epd_pos(int x, int y)
 
 void epd_load_lut(u8 *lut)
 {
-	epd_cmd(0x32);
-	epd_data_array(lut, lut_size);
-
-	epd_cmd1(0x03, lut[lut_size+0]);
-	epd_cmd3(0x04, lut[lut_size+1], lut[lut_size+2], lut[lut_size+3]);
-
-	if(lut_size==70){
-		epd_cmd1(0x3a, lut[lut_size+4]); // FR1
-		epd_cmd1(0x3b, lut[lut_size+5]); // FR2
-	}else{
-		epd_cmd1(0x2c, lut[lut_size+4]); // VCOM
-		epd_cmd1(0x3a, lut[lut_size+5]); // FR1
-		epd_cmd1(0x3b, lut[lut_size+6]); // FR2
-	}
+	epd_script_lut(epd_drv->lut_layout, lut);
 }
 
 
@@ -269,24 +481,79 @@ int epd_lut_size(void)
 		if(lut[i]!=0xa5)
 			break;
 	}
-	lut_size = i;
-	printk("LUT size: %d\n", lut_size);
+	printk("LUT size: %d\n", i);
 	//hex_dump("LUT", lut, 256);
 
-	if(lut_size==100){
-		lut_fast = lut_fast_100;
-		lut_fly  = lut_fly_100;
+	epd_lut_select(i);
+	return lut_size;
+}
+
+
+// 按LUT的长度选择控制器驱动. 长度已知时(保存过)可以不用探测. 不认识的按IL3897处理.
+void epd_lut_select(int size)
+{
+	int i;
+
+	lut_size = size;
+	epd_drv = &epd_drivers[0];
+	for(i=0; i<EPD_DRV_NUM; i++){
+		if(epd_drivers[i].lut_size==size){
+			epd_drv = &epd_drivers[i];
+			break;
+		}
 	}
+	printk("EPD driver: %s\n", epd_drv->name);
 
-	return lut_size;
+	// 没有温度传感器时按室温算(见epd_policy)
+	if((epd_drv->caps&DRV_TEMP)==0)
+		epd_temp = 20;
 }
 
 
+// 从断电或深度休眠唤醒后初始化寄存器. 窗口为整屏, LUT需要重新加载.
+static void epd_init_regs(void)
+{
+	if(init_script && (epd_drv->caps&DRV_SCRIPT)){
+		epd_script(init_script);
+		win_x = 0;
+		win_y = 0;
+		ram_x0 = 0;
+		ram_y0 = 0;
+		epd_window_size(line_bytes*8, scr_h);
+	}else{
+		epd_script(epd_drv->init_head);
+		epd_window(0, 0, scr_w-1, scr_h-1);
+		epd_script(epd_drv->init_tail);
+	}
+
+	ram_win.x1 = 0;
+	ram_win.y1 = 0;
+	ram_win.x2 = (line_bytes-1)*8;
+	ram_win.y2 = scr_h-1;
+	lut_loaded = NULL;
+}
+
+
+// 唤醒控制器. 根据当前状态只做必要的部分:
+//   EPD_ST_OFF  : 上电, 复位, 完整初始化
+//   EPD_ST_SLEEP: 硬件复位(深度休眠只能这样唤醒, 寄存器恢复默认值), 完整初始化
+//   EPD_ST_IDLE : 寄存器都还在, 什么都不用做
 void epd_init(void)
 {
 	//printk("epd_init: %dx%d\n", scr_w, scr_h);
 
-	epd_power(1);
+	if(epd_powered()==0)
+		epd_state = EPD_ST_OFF;
+
+	if(epd_state==EPD_ST_IDLE)
+		return;
+
+	if(epd_state==EPD_ST_SLEEP){
+		epd_reset(0);
+		delay_ms(1);
+	}else{
+		epd_power(1);
+	}
 	epd_reset(1);
 
 #if 0
@@ -298,111 +565,397 @@ void epd_init(void)
 //	epd_lut_size();
 #endif
 
-	epd_cmd1(0x74, 0x54);
-	epd_cmd1(0x7e, 0x3b);
+	epd_init_regs();
+	epd_state = EPD_ST_IDLE;
+}
+
 
-	epd_cmd2(0x2b, 0x04, 0x63);
-	epd_cmd4(0x0c, 0x8b, 0x9c, 0x96, 0x0f);
+void epd_update_mode(int mode)
+{
+	update_mode = mode;
+}
 
-	epd_cmd3(0x01, scr_h-1, (scr_h-1)>>8, 0x00);  // Gate Driver output control
-	epd_cmd1(0x11, 0x03);  // data entry mode
-	epd_cmd1(0x3c, 0x05);  // border wavefrom
 
-	epd_window(0, 0, scr_w-1, scr_h-1);
+// 读内置温度传感器(epd_init中已用0x18选择). 0x1b返回12位温度, 第一个字节是整数部分.
+// 0xb1同时会从OTP加载LUT, 之后要重新加载自己的LUT.
+int epd_read_temp(void)
+{
+	u8 buf[2];
 
-	epd_cmd1(0x18, 0x80);  // Read Built-in temperature sensor
+	epd_cmd1(0x22, 0xb1);  // load temperature
+	epd_cmd(0x20);
+	epd_wait();
+	epd_cmd_read(0x1b, buf, 2);
+
+	epd_temp = (signed char)buf[0];
+	temp_left = EPD_TEMP_AGE;
+	lut_loaded = NULL;
+	return epd_temp;
 }
 
 
-void epd_update_mode(int mode)
+static int epd_lut_scale(void)
 {
-	update_mode = mode;
+	int i;
+
+	for(i=0; lut_bands[i].temp<127; i++){
+		if(epd_temp<lut_bands[i].temp)
+			break;
+	}
+	return lut_bands[i].scale;
+}
+
+
+// 生成实际使用的LUT: 按温度调整相位长度. keep_red时清掉LUT2/LUT3,
+// 三色屏上红色像素(0x26为1)就不会被驱动, 保持原来的红色.
+static u8 *epd_lut_temp(u8 *lut, int scale, int keep_red)
+{
+	int groups = epd_drv->groups;
+	int base = groups*5;  // 5个LUT之后是Group
+	int i, j;
+
+	if(groups==0 || (scale==16 && keep_red==0))
+		return lut;
+
+	memcpy(lut_temp, lut, base+groups*5+7);
+	if(keep_red)
+		memset(lut_temp+groups*2, 0, groups*2);
+	for(i=0; i<groups; i++){
+		u8 *tp = lut_temp+base+i*5;
+		for(j=0; j<4; j++){
+			if(tp[j]==0)
+				continue;
+			int v = (tp[j]*scale+8)>>4;
+			tp[j] = (v<1)? 1 : (v>255)? 255 : v;
+		}
+	}
+
+	return lut_temp;
 }
 
 
 void epd_update(void)
 {
+	EPD_DRV *drv = epd_drv;
+	int mode = update_mode;
 	int seq;
 
-	if(update_mode==UPDATE_FULL){
-		seq = 0xf7;
+	if(mode==UPDATE_FLY && (drv->caps&DRV_PARTIAL)==0)
+		mode = UPDATE_FAST;
+	// 红色有变化时只能用OTP中的三色波形. 没有变化时用只刷黑白的LUT.
+	if(scr_mode&EPD_BWR){
+		if(red_changed && (drv->caps&DRV_OTP))
+			mode = UPDATE_FULL;
+		red_changed = 0;
+	}
+	update_mode = mode;
+
+	if(mode==UPDATE_FULL && (drv->caps&DRV_OTP)){
+		// OTP中的波形自带温度补偿. 刷新时会从OTP加载LUT.
+		if(drv->caps&DRV_TEMP)
+			epd_read_temp();
+		lut_loaded = NULL;
+		seq = drv->seq_full;
 	}else{
-		if(update_mode==UPDATE_FAST){
-			epd_load_lut(lut_fast);
-		}else{
-			epd_load_lut(lut_fly);
+		u8 *lut = (mode==UPDATE_FULL)? drv->lut_full : (mode==UPDATE_FAST)? drv->lut_fast : drv->lut_fly;
+		int scale = 16;
+
+		if(drv->caps&DRV_TEMP){
+			// 温度变化很慢, 不用每次都测. 测温要等BUSY, 也会覆盖已加载的LUT.
+			if(temp_left==0)
+				epd_read_temp();
+			temp_left -= 1;
+			scale = epd_lut_scale();
 		}
-		seq = 0xc7;
+
+		int keep_red = (scr_mode&EPD_BWR)? 1: 0;
+		scale |= keep_red<<8;
+
+		if(lut!=lut_loaded || scale!=lut_scale){
+			epd_script_lut(drv->lut_layout, epd_lut_temp(lut, scale&0xff, keep_red));
+			lut_loaded = lut;
+			lut_scale = scale;
+		}
+		seq = (mode==UPDATE_FULL)? drv->seq_full : drv->seq_lut;
 	}
 
 	epd_cmd1(0x22, seq);
 	epd_cmd(0x20);
+	epd_stat_start(mode);
 }
 
 
 void epd_sleep(void)
 {
 	epd_cmd1(0x10, 01);
+	epd_state = EPD_ST_SLEEP;
+}
+
+
+// 刷新完成后调用. EPD_KEEP_IDLE为0时进入深度休眠, 否则保持唤醒.
+void epd_standby(void)
+{
+#if EPD_KEEP_IDLE
+	epd_state = EPD_ST_IDLE;
+#else
+	epd_sleep();
+#endif
 }
 
 
 /******************************************************************************/
 
-void epd_screen_update(void)
+// 把RAM窗口缩小到r(原生坐标, 一般是fb_dirty), 之后epd_screen_update只发送这部分.
+// 屏RAM中的其它部分必须还是上一帧的内容. 返回0表示只能发送整屏, 这时窗口设为整屏.
+// 刷新仍然是整屏的: 这类控制器没有区域刷新, 省下的是传输.
+int epd_screen_window(RECT *r)
+{
+	int x1, y1, x2, y2;
+	int part = 1;
+
+	if(epd_ram_valid==0 || rect_empty(r))
+		part = 0;
+	// 镜像时fb与屏RAM的列顺序相反, 不做局部发送. 窗口一直是epd_init设置的整屏.
+	if(scr_mode&(MIRROR_H|MIRROR_V)){
+		part = 0;
+		goto _set_pos;
+	}
+
+	if(part){
+		x1 = r->x1&~0x07;
+		x2 = r->x2&~0x07;
+		y1 = r->y1;
+		y2 = r->y2;
+	}else{
+		x1 = 0;
+		x2 = (line_bytes-1)*8;
+		y1 = 0;
+		y2 = scr_h-1;
+	}
+
+	// 只改RAM地址范围. 0x01/0x0f决定扫描的Gate, 不能跟着窗口变.
+	if(x1!=ram_win.x1 || x2!=ram_win.x2 || y1!=ram_win.y1 || y2!=ram_win.y2){
+		u8 script[] = {
+			0x44, 2, x1>>3, x2>>3,              // set Ram-X address start/end position
+			0x45, 4, B0(y1), B1(y1), B0(y2), B1(y2),  // set Ram-Y address start/end position
+			SCRIPT_END,
+		};
+		epd_script(script);
+		ram_win.x1 = x1;
+		ram_win.y1 = y1;
+		ram_win.x2 = x2;
+		ram_win.y2 = y2;
+	}
+
+	win_x = x1;
+	win_y = y1;
+	win_w = x2-x1+8;
+	win_h = y2-y1+1;
+	ram_x0 = x1>>3;
+	ram_y0 = y1;
+
+_set_pos:
+	// 上次写RAM后地址计数器已经移走了
+	epd_cmd1(0x4e, ram_x0);                      // set RAM-x address
+	epd_cmd2(0x4f, B0(ram_y0), B1(ram_y0));      // set RAM-y address
+	return part;
+}
+
+
+#define HASH_INIT  0x811c9dc5  // FNV-1a
+
+static u32 epd_hash_line(u32 hash, u8 *p)
 {
 	int i;
 
-	epd_cmd(0x24);  // write RAM for black(0)/white(1)
-	for(i=0; i<win_h*line_bytes; i++){
-		epd_data(fb_bw[i]);
+	for(i=0; i<line_bytes; i++){
+		hash = (hash^p[i])*0x01000193;
 	}
+	return hash;
+}
+
+
+static u32 epd_row_hash(int y)
+{
+	u32 hash;
+
+	fb_band(y);
+	hash = epd_hash_line(HASH_INIT, fb_bw+(y-fb_top)*line_bytes);
+	if(scr_mode&EPD_BWR)
+		hash = epd_hash_line(hash, fb_rr+(y-fb_top)*line_bytes);
+
+	return hash;
+}
+
+
+#if EPD_STRIP_LINES
+// 分条绘制时没有整屏的红色平面, 不能在绘制时逐点比较(见fb_clear). 另外记下红色
+// 平面每一行的hash, 由epd_screen_diff判断红色是否真的变了.
+static u32 row_hash_rr[EPD_MAX_LINES];
+
+static u32 epd_row_hash_rr(int y)
+{
+	fb_band(y);
+	return epd_hash_line(HASH_INIT, fb_rr+(y-fb_top)*line_bytes);
+}
+#endif
+
+
+// 与屏上显示的帧逐行比较, 把r的行范围缩小到真正改变的行. 新的hash在刷新完成后
+// 才记下(epd_screen_sync), 丢失的刷新下次会重发.
+// r以外的行没有被改动过(见fb_dirty), 不用比较. 屏RAM无效时r扩大到整屏.
+// 返回0表示与屏上的内容完全相同, 可以不刷新.
+int epd_screen_diff(RECT *r)
+{
+	int y, y1 = -1, y2 = -1;
+#if EPD_STRIP_LINES
+	int red = 0;
+#endif
+
+	if(epd_ram_valid==0 || scr_h>EPD_MAX_LINES){
+		r->x1 = 0;
+		r->y1 = 0;
+		r->x2 = line_bytes*8-1;
+		r->y2 = scr_h-1;
+		return 1;
+	}
+
+	if(rect_empty(r))
+		return 0;
+
+	for(y=r->y1; y<=r->y2; y++){
+		if(epd_row_hash(y)!=row_hash[y]){
+			if(y1<0)
+				y1 = y;
+			y2 = y;
+		}
+#if EPD_STRIP_LINES
+		if(fb_red_dirty && (scr_mode&EPD_BWR) && red==0 && epd_row_hash_rr(y)!=row_hash_rr[y])
+			red = 1;
+#endif
+	}
+#if EPD_STRIP_LINES
+	// 红色与屏上的相同时不发送红色平面, 也不用三色波形(见epd_update)
+	if(scr_mode&EPD_BWR)
+		fb_red_dirty = red;
+#endif
+
+	if(y1<0){
+		rect_clear(r);
+		return 0;
+	}
+	r->y1 = y1;
+	r->y2 = y2;
+	return 1;
+}
+
+
+// 分条绘制时每画好一条发送一次. 每次都是新的写RAM命令, 地址计数器接着上次的位置,
+// 这样画下一条时(可能要读Flash字库)不会占着屏的CS.
+static void epd_screen_plane(int cmd, u8 *fb)
+{
+	int bytes = win_w>>3;
+	int y, n, i;
+	u8 *p;
+
+	for(y=win_y; y<win_y+win_h; y+=n){
+		n = fb_band(y);
+		if(n>win_y+win_h-y)
+			n = win_y+win_h-y;
+		p = fb+(y-fb_top)*line_bytes+(win_x>>3);
+
+		epd_write_start(cmd);
+		if(bytes==line_bytes){
+			epd_write_data(p, n*line_bytes);
+		}else{
+			for(i=0; i<n; i++){
+				epd_write_data(p, bytes);
+				p += line_bytes;
+			}
+		}
+		epd_write_end();
+	}
+}
+
+
+// 三色屏的红色平面没有变化时不发送, 刷新也不用慢的三色波形(见epd_update).
+void epd_screen_update(void)
+{
+	epd_xfer_start();
+	epd_screen_plane(0x24, fb_bw);  // write RAM for black(0)/white(1)
 	if(scr_mode&EPD_BWR){
-		epd_cmd(0x26);
-		for(i=0; i<win_h*line_bytes; i++){
-			epd_data(fb_rr[i]);
+		if(fb_red_dirty || epd_ram_valid==0){
+			epd_screen_plane(0x26, fb_rr);  // write RAM for red(1)/other(0)
+			red_changed = 1;
+		}
+		fb_red_dirty = 0;
+	}
+	epd_xfer_end();
+	epd_ram_valid = 1;
+}
+
+
+// 刷新完成后在主循环中调用(这时fb还是发送的那一帧). 记下窗口中各行的hash,
+// 并把窗口内容也写入0x26(old RAM), 使old RAM始终是屏上显示的内容.
+// 这样fly/fast刷新时LUT的B->B/B->W/W->B/W->W才能按真实的新旧像素选择波形.
+// 三色屏的0x26是红色平面, 不能这样用.
+void epd_screen_sync(void)
+{
+	int y;
+
+	if(scr_h<=EPD_MAX_LINES){
+		for(y=win_y; y<win_y+win_h; y++){
+			row_hash[y] = epd_row_hash(y);
+#if EPD_STRIP_LINES
+			if(scr_mode&EPD_BWR)
+				row_hash_rr[y] = epd_row_hash_rr(y);
+#endif
 		}
 	}
+
+	if((scr_mode&EPD_BWR) || (epd_drv->caps&DRV_OLD_RAM)==0)
+		return;
+
+	epd_cmd1(0x4e, ram_x0);
+	epd_cmd2(0x4f, B0(ram_y0), B1(ram_y0));
+	epd_screen_plane(0x26, fb_bw);
 }
 
 
 void epd_screen_clean(int mode)
 {
-	int x, y;
+	int y;
+	int lw = win_w/8;
+	int hw = (win_w/2+7)/8;  // 左半边的字节数
 
-	epd_cmd(0x24);  // write RAM for black(0)/white(1)
+	epd_ram_valid = 0;
+	epd_write_start(0x24);  // write RAM for black(0)/white(1)
 	for(y=0; y<win_h; y++){
-		for(x=0; x<win_w; x+=8){
-			int d;
-			if(mode==2){
-				if(y<(win_h/2)){
-					d = (x<win_w/2)? 0x77 : 0x00;
-				}else{
-					d = (x<win_w/2)? 0x00 : 0xff;
-				}
-			}else if(mode==1){
-				d = 0xff;
+		if(mode==2){
+			if(y<(win_h/2)){
+				epd_write_fill(0x77, hw);
+				epd_write_fill(0x00, lw-hw);
 			}else{
-				d = 0x00;
+				epd_write_fill(0x00, hw);
+				epd_write_fill(0xff, lw-hw);
 			}
-			epd_data(d);
+		}else{
+			epd_write_fill((mode==1)? 0xff : 0x00, lw);
 		}
 	}
+	epd_write_end();
 
 	if(scr_mode&EPD_BWR){
-		epd_cmd(0x26);  // write RAM for red(1)/other(0)
+		epd_write_start(0x26);  // write RAM for red(1)/other(0)
 		for(y=0; y<win_h; y++){
-			for(x=0; x<win_w; x+=8){
-				int d = 0x00;
-				if(mode==2){
-					if(y<(win_h/2)){
-						d = 0x00;
-					}else{
-						d = (x<win_w/2)? 0xff : 0x00;
-					}
-				}
-				epd_data(d);
+			if(mode==2 && y>=(win_h/2)){
+				epd_write_fill(0xff, hw);
+				epd_write_fill(0x00, lw-hw);
+			}else{
+				epd_write_fill(0x00, lw);
 			}
 		}
+		epd_write_end();
 	}
 }
 
@@ -1,12 +1,25 @@
 
 
+#ifdef EPD_HOST
+// 在PC上编译(gcc -DEPD_HOST), 总线使用epd_bus_host.c中的记录器.
+#include <stdio.h>
+#include <string.h>
+#define printk printf
+#define __SECTION_ZERO(sec)
+#else
 #include "user_config.h"
+#endif
 
 
 typedef unsigned  char  u8;
 typedef unsigned short  u16;
 typedef unsigned   int  u32;
 
+// 矩形区域, 屏的原生坐标(与fb_bw/fb_rr的排列相同). x1>x2表示空.
+typedef struct {
+	short x1, y1, x2, y2;
+}RECT;
+
 
 void delay_ms(int ms);
 
@@ -21,20 +34,84 @@ int gpio_get(int index);
 #define ERASE_32K  0x52
 int fspi_config(u32 gpio_word);
 int fspi_init(void);
+int fspi_exit(void);
 int sf_readid(void);
 int sf_sector_erase(int cmd, int addr, int wait);
 int sf_page_write(int addr, u8 *buf, int size);
 int sf_read(int addr, int len, u8 *buf);
 int selflash(int otp_boot);
 
-// epd_hw
+// epd spi
+int espi_init(int clk, int sdo);
+int espi_exit(int clk, int sdo);
+void espi_write(int data);
+void espi_write_array(u8 *buf, int len);
+void espi_fill(int data, int len);
+
+// epd_bus
+typedef struct {
+	char *name;
+	void (*config)(u32 config0, u32 config1);
+	void (*open)(void);
+	void (*close)(void);
+	void (*power)(int on);
+	void (*reset)(int val);
+	int  (*busy)(void);
+	void (*notify)(void (*cb)(void));  // BUSY变低时在主循环中调用cb. cb为NULL时取消.
+	void (*cs)(int val);
+	void (*dc)(int val);
+	void (*write)(u8 *data, int len);
+	void (*fill)(int data, int len);
+	void (*read)(u8 *data, int len);
+	void (*timer_start)(void);
+	u32  (*timer_us)(void);
+	u32  (*clock)(void);   // 休眠期间也走的时钟, 625us为单位. 用于计量刷新时间.
+	void (*flash_read)(int addr, int len, u8 *buf);  // 读SPI Flash. buf要4字节对齐, 长度按4字节取整.
+}EPD_BUS;
+
+extern EPD_BUS *epd_bus;
+extern EPD_BUS epd_bus_gpio;
+extern EPD_BUS epd_bus_spi;
+extern EPD_BUS epd_bus_host;
+
 void epd_hw_init(u32 config0, u32 config1, int w, int h, int mode);
+void epd_hw_bus(EPD_BUS *bus);
 void epd_hw_open(void);
 void epd_hw_close(void);
+void epd_hw_restore(void);
+void epd_xfer_start(void);
+void epd_xfer_end(void);
+u32  epd_xfer_total(void);
+void epd_xfer_report(void);
 void epd_reset(int val);
 void epd_wait(void);
 int  epd_busy(void);
+void epd_busy_notify(void (*cb)(void));
+int  epd_busy_pending(void);
 void epd_power(int on);
+int  epd_powered(void);
+
+// epd_bus_host
+#define REC_CMD   0
+#define REC_DATA  1
+#define REC_READ  2
+#define REC_RST   3
+#define REC_PWR   4
+
+typedef struct {
+	u32 time;  // 合成时钟, 微秒
+	u8  type;
+	u8  data;
+}EPD_REC;
+
+extern EPD_REC host_rec[];
+extern int host_rec_num;
+extern u32 host_clock;
+extern u8 *host_read_data;
+extern u8 *host_flash;
+extern int host_flash_size;
+extern int host_flash_reads;
+void host_rec_clear(void);
 
 void epd_cmd(int cmd);
 void epd_cmd1(int cmd, int d0);
@@ -45,31 +122,139 @@ void epd_data(int data);
 void epd_data_array(u8 *data, int len);
 void epd_read(u8 *data, int len);
 void epd_cmd_read(int cmd, u8 *data, int len);
+void epd_write_start(int cmd);
+void epd_write_data(u8 *data, int len);
+void epd_write_fill(int data, int len);
+void epd_write_end(void);
+
+#define SCRIPT_END  0xff
+void epd_script(const u8 *script);
+void epd_script_lut(const u8 *layout, u8 *data);
+
+// 控制器驱动
+#define DRV_OTP      0x01  // 有OTP波形, 全刷不用写LUT
+#define DRV_TEMP     0x02  // 内置温度传感器, 可用0x1b读出
+#define DRV_OLD_RAM  0x04  // 黑白屏的0x26是old RAM
+#define DRV_PARTIAL  0x08  // 可以用自己的LUT做局部刷新
+#define DRV_SCRIPT   0x10  // 可以使用预编译的初始化脚本(SCRIPT_INIT_HEAD/TAIL)
+
+typedef struct {
+	char *name;
+	u8  lut_size;     // LUT(0x32)的长度, 用于识别
+	u8  caps;
+	u8  groups;       // LUT中Group的个数, 按温度调整相位长度用. 0表示不调整.
+	u8  seq_full;     // 全刷时0x22的参数
+	u8  seq_lut;      // 使用自己的LUT时0x22的参数
+	const u8 *init_head;
+	const u8 *init_tail;
+	const u8 *lut_layout;
+	u8 *lut_full;     // 没有OTP时全刷使用
+	u8 *lut_fast;
+	u8 *lut_fly;
+}EPD_DRV;
+
+extern EPD_DRV *epd_drv;
 
 // epd_xxx
 void epd_init(void);
+void epd_select_script(void);
 void epd_update_mode(int mode);
 void epd_update();
+int  epd_read_temp(void);
 void epd_sleep(void);
+void epd_standby(void);
 void epd_window(int x1, int y1, int x2, int y2);
+int  epd_screen_diff(RECT *r);
+int  epd_screen_window(RECT *r);
 void epd_screen_update(void);
+void epd_screen_sync(void);
 void epd_screen_clean(int mode);
 int  epd_detect(void);
+int  epd_lut_size(void);
+void epd_lut_select(int size);
+int  epd_panel_load(void);
+int  epd_panel_flash(void);
+void epd_panel_save(void);
 
 
 extern u8 lut_p[];
+extern int epd_temp;
+
+
+// epd_policy
+typedef struct {
+	u16 fly_budget;     // 一个区域累计fly刷新多少次后做一次fast
+	u16 fast_budget;    // 累计fast多少次后做一次full
+	u16 full_interval;  // 最长多少分钟做一次full
+	signed char cold_temp;  // 低于此温度时fly的代价按1.5次算
+	signed char hot_temp;   // 高于此温度时fly的代价按1.5次算
+}EPD_POLICY;
+
+extern EPD_POLICY epd_policy;
+void epd_policy_tick(int secs);
+int  epd_policy_mode(int want);
+void epd_policy_done(RECT *r, int mode);
+
+// epd_stat
+void epd_stat_start(int mode);
+void epd_stat_done(void);
+void epd_stat_clear(void);
+int  epd_stat_read(u8 *buf, int len);
 
+// epd_font
+const u8 *fstore_find(int ucs);
+int  fstore_flags(void);
+void fstore_report(void);
 
 // epd_gui
+// 分条绘制: 不用整屏的FB, 每次只画EPD_STRIP_LINES行(原生), 逐条发送. 0表示整屏FB.
+// 这时每一帧都要从fb_clear开始整屏重画, 不能只擦掉重画改动的区域.
+#ifndef EPD_STRIP_LINES
+#define EPD_STRIP_LINES  0
+#endif
+
+extern RECT fb_dirty;
+extern int fb_red_dirty;
+void rect_clear(RECT *r);
+int  rect_empty(RECT *r);
+void rect_union(RECT *r, RECT *s);
+int  rect_overlap(RECT *a, RECT *b);
+void fb_clear(void);
+void fb_clear_rect(RECT *r);
+void fb_fill_rect(RECT *r, int color);
+void fb_select_kernel(void);
+int  fb_band(int y);
+int  fb_overflow(void);
+
 void draw_pixel(int x, int y, int color);
 void draw_hline(int y, int x1, int x2, int color);
 void draw_vline(int x, int y1, int y2, int color);
 void draw_rect(int x1, int y1, int x2, int y2, int color);
 void draw_box(int x1, int y1, int x2, int y2, int color);
+void draw_bitmap(int x, int y, int w, int h, const u8 *bits, int color);
 void draw_char(int x, int y, int ch, int color);
-void draw_text(int x, int y, char *str, int color);
+int  draw_text(int x, int y, char *str, int color);
+#define GR_END  0xffff
+int  draw_glyph_run(int x, int y, const u16 *run, int color);
 int select_font(int id);
 void fb_test(void);
+// 部件缓存, 只用于分条绘制
+u8  *fb_cache_alloc(int x, int y, int w, int h, RECT *r);
+int  fb_cache_begin(void);
+void fb_cache_end(int mark, RECT *r, u8 *bits);
+void fb_cache_put(RECT *r, u8 *bits);
+
+// epd_widget
+// 部件: key没变的不重画. x,y,w,h(屏幕坐标)是分条绘制时缓存的范围, w为0表示不缓存.
+typedef struct {
+	short x, y, w, h;
+	int key;
+	RECT rect;    // 整屏FB时是上次画出的范围, 缓存时是缓存的原生矩形
+	u8 *bits;
+	u8 state;
+}EPD_WIDGET;
+
+void epd_widget_update(EPD_WIDGET *wg, int num, const int *key, void (*draw)(int id, int flags), int flags, int all);
 
 
 #define EPD_BWR   0x20
@@ -97,13 +282,18 @@ extern int scr_mode;
 extern int line_bytes;
 extern int scr_padding;
 extern int update_mode;
+extern int lut_size;
 
+extern int win_x;
+extern int win_y;
 extern int win_w;
 extern int win_h;
+extern int epd_ram_valid;
 
 extern int fb_w;
 extern int fb_h;
 
+extern int fb_top;
 extern u8 fb_bw[];
 extern u8 fb_rr[];
 
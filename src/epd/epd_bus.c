@@ -0,0 +1,396 @@
+#include "epd.h"
+
+
+/******************************************************************************/
+
+// 当前使用的总线. epd_cmd*/epd_data*等都通过它访问屏.
+#ifdef EPD_HOST
+EPD_BUS *epd_bus = &epd_bus_host;
+#else
+EPD_BUS *epd_bus = &epd_bus_gpio;
+#endif
+
+
+// 传输统计
+static u32 xfer_count;
+static u32 xfer_bytes;
+static u32 xfer_cs_count;
+static u32 xfer_cs;
+static u32 xfer_us;
+
+// 各总线最近一次传输的统计, 用于比较gpio与spi的速度
+#define XFER_BUSES  2
+typedef struct {
+	EPD_BUS *bus;
+	u32 bytes;
+	u32 us;
+}XFER_RATE;
+static XFER_RATE xfer_rate[XFER_BUSES];
+
+static int epd_pwr_on;
+
+
+#define EPD_CS(n)   do{ xfer_cs_count += !(n); epd_bus->cs(n); }while(0)
+#define EPD_DC(n)   epd_bus->dc(n)
+
+
+/******************************************************************************/
+
+
+void epd_hw_init(u32 config0, u32 config1, int w, int h, int mode)
+{
+	epd_bus->config(config0, config1);
+
+	scr_w = w;
+	scr_h = h;
+	scr_mode = mode;
+	line_bytes = (scr_w+7)>>3;
+	scr_padding = line_bytes*8-scr_w;
+
+	epd_select_script();
+	fb_select_kernel();
+}
+
+
+// 选择总线. 只能在屏关闭时切换, 在下次epd_hw_open时生效.
+void epd_hw_bus(EPD_BUS *bus)
+{
+	epd_bus = bus;
+}
+
+
+void epd_hw_open(void)
+{
+	epd_bus->open();
+}
+
+
+void epd_hw_close(void)
+{
+	epd_bus->close();
+}
+
+
+void epd_reset(int val)
+{
+	epd_bus->reset(val);
+}
+
+
+void epd_power(int on)
+{
+	epd_bus->power(on);
+	epd_pwr_on = on;
+	if(on==0)
+		epd_ram_valid = 0;
+}
+
+
+// 屏是否在供电. 关闭总线(epd_hw_close)时屏可以保持供电, 在深度休眠中保留RAM.
+int epd_powered(void)
+{
+	return epd_pwr_on;
+}
+
+
+int epd_busy(void)
+{
+	return epd_bus->busy();
+}
+
+
+void epd_wait(void)
+{
+	while(epd_bus->busy());
+	epd_stat_done();
+}
+
+
+static void (*busy_done_cb)(void);
+static int busy_waiting;
+static u32 busy_start;
+
+// 刷新最长的也只要几秒, 超过这个时间(ms)还没有完成就认为丢了.
+#define EPD_BUSY_TIMEOUT  20000
+
+static void epd_busy_done(void)
+{
+	void (*cb)(void) = busy_done_cb;
+
+	busy_done_cb = NULL;
+	busy_waiting = 0;
+	epd_stat_done();
+	if(cb)
+		cb();
+}
+
+
+// BUSY变低时调用cb. 硬件上用中断实现, 等待期间可以休眠. cb在主循环中执行.
+void epd_busy_notify(void (*cb)(void))
+{
+	busy_done_cb = cb;
+	busy_waiting = 1;
+	busy_start = epd_bus->clock();
+	epd_bus->notify(epd_busy_done);
+}
+
+
+// 是否还在等待epd_busy_notify的回调. 这期间不能访问屏.
+// 等待超时时认为这次刷新丢了: 取消等待并给屏断电, 下次从头初始化, 整屏发送.
+int epd_busy_pending(void)
+{
+	if(busy_waiting==0)
+		return 0;
+	if((epd_bus->clock()-busy_start)*5/8 < EPD_BUSY_TIMEOUT)
+		return 1;
+
+	printk("EPD: busy timeout\n");
+	epd_bus->notify(NULL);
+	busy_done_cb = NULL;
+	busy_waiting = 0;
+	epd_power(0);
+	epd_hw_close();
+	return 0;
+}
+
+
+/******************************************************************************/
+
+
+static void epd_write_byte(int data)
+{
+	u8 d = data;
+	epd_bus->write(&d, 1);
+	xfer_count += 1;
+}
+
+
+void epd_cmd(int cmd)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_CS(1);
+}
+
+
+void epd_data(int data)
+{
+	EPD_CS(0);
+	EPD_DC(1);
+	epd_write_byte(data);
+	EPD_CS(1);
+}
+
+
+void epd_cmd1(int cmd, int d0)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+	epd_write_byte(d0);
+	EPD_CS(1);
+}
+
+
+void epd_cmd2(int cmd, int d0, int d1)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+	epd_write_byte(d0);
+	epd_write_byte(d1);
+	EPD_CS(1);
+}
+
+
+void epd_cmd3(int cmd, int d0, int d1, int d2)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+	epd_write_byte(d0);
+	epd_write_byte(d1);
+	epd_write_byte(d2);
+	EPD_CS(1);
+}
+
+
+void epd_cmd4(int cmd, int d0, int d1, int d2, int d3)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+	epd_write_byte(d0);
+	epd_write_byte(d1);
+	epd_write_byte(d2);
+	epd_write_byte(d3);
+	EPD_CS(1);
+}
+
+
+void epd_data_array(u8 *data, int len)
+{
+	EPD_CS(0);
+	EPD_DC(1);
+	epd_write_data(data, len);
+	EPD_CS(1);
+}
+
+
+/******************************************************************************/
+
+// 连续写RAM: 命令与之后的所有数据只占用一次CS.
+// epd_write_start与epd_write_end之间可以多次调用epd_write_data/epd_write_fill.
+
+void epd_write_start(int cmd)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+}
+
+
+void epd_write_data(u8 *data, int len)
+{
+	epd_bus->write(data, len);
+	xfer_count += len;
+}
+
+
+// 重复写同一个字节, 用于清屏等不需要缓冲区的场合.
+void epd_write_fill(int data, int len)
+{
+	epd_bus->fill(data, len);
+	xfer_count += len;
+}
+
+
+void epd_write_end(void)
+{
+	EPD_CS(1);
+}
+
+
+void epd_read(u8 *data, int len)
+{
+	EPD_CS(0);
+	EPD_DC(1);
+	epd_bus->read(data, len);
+	EPD_CS(1);
+}
+
+
+void epd_cmd_read(int cmd, u8 *data, int len)
+{
+	EPD_CS(0);
+	EPD_DC(0);
+	epd_write_byte(cmd);
+	EPD_DC(1);
+	epd_bus->read(data, len);
+	EPD_CS(1);
+}
+
+
+/******************************************************************************/
+
+// 执行命令脚本. 格式: cmd, len, data[len], ..., SCRIPT_END
+// 整个脚本只拉低一次CS, 命令与数据用DC区分. 脚本中不能有读操作, 也不能有
+// 需要等待BUSY的命令(SWRESET, Master Activation).
+void epd_script(const u8 *script)
+{
+	EPD_CS(0);
+	while(script[0]!=SCRIPT_END){
+		int len = script[1];
+		EPD_DC(0);
+		epd_write_byte(script[0]);
+		EPD_DC(1);
+		if(len)
+			epd_write_data((u8*)script+2, len);
+		script += 2+len;
+	}
+	EPD_CS(1);
+}
+
+
+// 按layout发送data中的各段. 格式: cmd, len, offset, ..., SCRIPT_END
+// 用于LUT这类由多条命令组成, 数据在同一个数组里的序列.
+void epd_script_lut(const u8 *layout, u8 *data)
+{
+	EPD_CS(0);
+	while(layout[0]!=SCRIPT_END){
+		EPD_DC(0);
+		epd_write_byte(layout[0]);
+		EPD_DC(1);
+		epd_write_data(data+layout[2], layout[1]);
+		layout += 3;
+	}
+	EPD_CS(1);
+}
+
+
+/******************************************************************************/
+
+
+void epd_xfer_start(void)
+{
+	xfer_bytes = xfer_count;
+	xfer_cs = xfer_cs_count;
+	epd_bus->timer_start();
+}
+
+
+void epd_xfer_end(void)
+{
+	int i;
+
+	xfer_us = epd_bus->timer_us();
+	xfer_bytes = xfer_count - xfer_bytes;
+	xfer_cs = xfer_cs_count - xfer_cs;
+
+	for(i=0; i<XFER_BUSES; i++){
+		if(xfer_rate[i].bus==epd_bus || xfer_rate[i].bus==NULL){
+			xfer_rate[i].bus = epd_bus;
+			xfer_rate[i].bytes = xfer_bytes;
+			xfer_rate[i].us = xfer_us;
+			break;
+		}
+	}
+}
+
+
+// 总传输字节数. 用于统计各种刷新方式的传输量.
+u32 epd_xfer_total(void)
+{
+	return xfer_count;
+}
+
+
+static u32 xfer_bps(u32 bytes, u32 us)
+{
+	if(us==0)
+		us = 1;
+	return (u32)((bytes*1000000ULL)/us);
+}
+
+
+// 报告这一次的传输, 以及用过的各总线最近一次的速度.
+void epd_xfer_report(void)
+{
+	int i;
+
+	printk("EPD %s: %d bytes, %d cs, in %d us, %d B/s\n", epd_bus->name,
+			xfer_bytes, xfer_cs, xfer_us, xfer_bps(xfer_bytes, xfer_us));
+	for(i=0; i<XFER_BUSES && xfer_rate[i].bus; i++){
+		printk("    %s: %d B/s\n", xfer_rate[i].bus->name, xfer_bps(xfer_rate[i].bytes, xfer_rate[i].us));
+	}
+}
+
+
+/******************************************************************************/
+
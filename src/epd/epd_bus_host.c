@@ -0,0 +1,200 @@
+#include "epd.h"
+
+// PC上的记录总线. 不接真实硬件, 把所有命令与数据按顺序记录在host_rec中, 并用
+// 合成时钟估算传输时间. 用于离线查看epd.c的命令序列与统计传输量, 与自己写的
+// main一起编译:
+//
+//     gcc -DEPD_HOST -I. epd.c epd_gui.c epd_bus.c epd_bus_host.c epd_policy.c epd_stat.c epd_font.c epd_widget.c main.c
+//
+// 固件中不编译此文件.
+
+#ifdef EPD_HOST
+
+
+/******************************************************************************/
+
+#define HOST_REC_MAX   32768
+
+// 合成时钟参数: SPI 4MHz, 每字节2us; 每次CS/DC切换1us.
+#define HOST_BYTE_US   2
+#define HOST_EDGE_US   1
+
+EPD_REC host_rec[HOST_REC_MAX];
+int host_rec_num;
+u32 host_clock;
+
+// epd_read/epd_cmd_read返回的数据. 为NULL时返回0.
+u8 *host_read_data;
+
+// SPI Flash的内容(比如fontc.py pack生成的字库, 放在对应的地址). 之外的读出0xff.
+u8 *host_flash;
+int host_flash_size;
+int host_flash_reads;
+
+static int host_dc_val;
+static u32 host_timer;
+
+
+static void host_record(int type, int data)
+{
+	if(host_rec_num<HOST_REC_MAX){
+		host_rec[host_rec_num].time = host_clock;
+		host_rec[host_rec_num].type = type;
+		host_rec[host_rec_num].data = data;
+		host_rec_num += 1;
+	}
+}
+
+
+void host_rec_clear(void)
+{
+	host_rec_num = 0;
+	host_clock = 0;
+}
+
+
+/******************************************************************************/
+
+
+void delay_ms(int ms)
+{
+	host_clock += ms*1000;
+}
+
+
+static void host_config(u32 config0, u32 config1)
+{
+}
+
+
+static void host_open(void)
+{
+}
+
+
+static void host_close(void)
+{
+}
+
+
+static void host_power(int on)
+{
+	host_record(REC_PWR, on);
+}
+
+
+static void host_reset(int val)
+{
+	host_record(REC_RST, val);
+}
+
+
+static int host_busy(void)
+{
+	return 0;
+}
+
+
+static void host_notify(void (*cb)(void))
+{
+	if(cb)
+		cb();
+}
+
+
+static void host_cs(int val)
+{
+	host_clock += HOST_EDGE_US;
+}
+
+
+static void host_dc(int val)
+{
+	host_dc_val = val;
+	host_clock += HOST_EDGE_US;
+}
+
+
+static void host_write(u8 *data, int len)
+{
+	for(int i=0; i<len; i++){
+		host_record((host_dc_val)? REC_DATA : REC_CMD, data[i]);
+		host_clock += HOST_BYTE_US;
+	}
+}
+
+
+static void host_fill(int data, int len)
+{
+	for(int i=0; i<len; i++){
+		host_record(REC_DATA, data);
+		host_clock += HOST_BYTE_US;
+	}
+}
+
+
+static void host_read(u8 *data, int len)
+{
+	for(int i=0; i<len; i++){
+		data[i] = (host_read_data)? host_read_data[i] : 0;
+		host_record(REC_READ, data[i]);
+		host_clock += HOST_BYTE_US;
+	}
+}
+
+
+static void host_timer_start(void)
+{
+	host_timer = host_clock;
+}
+
+
+static u32 host_timer_us(void)
+{
+	return host_clock-host_timer;
+}
+
+
+static u32 host_clock_slots(void)
+{
+	return host_clock/625;
+}
+
+
+// 读命令与地址4字节, 数据与屏共用SPI的速度.
+static void host_flash_read(int addr, int len, u8 *buf)
+{
+	len = (len+3)&~3;
+	for(int i=0; i<len; i++){
+		buf[i] = (addr+i<host_flash_size)? host_flash[addr+i] : 0xff;
+	}
+	host_flash_reads += 1;
+	host_clock += HOST_EDGE_US*2 + (4+len)*HOST_BYTE_US;
+}
+
+
+EPD_BUS epd_bus_host = {
+	.name   = "host",
+	.config = host_config,
+	.open   = host_open,
+	.close  = host_close,
+	.power  = host_power,
+	.reset  = host_reset,
+	.busy   = host_busy,
+	.notify = host_notify,
+	.cs     = host_cs,
+	.dc     = host_dc,
+	.write  = host_write,
+	.fill   = host_fill,
+	.read   = host_read,
+	.timer_start = host_timer_start,
+	.timer_us    = host_timer_us,
+	.clock       = host_clock_slots,
+	.flash_read  = host_flash_read,
+};
+
+
+#endif
+
+/******************************************************************************/
+
@@ -0,0 +1,164 @@
+
+
+#include "epd.h"
+
+
+/******************************************************************************/
+
+// SPI Flash中的字库(tools/fontc.py pack生成, 格式见fontc.py). 内置字库(sfont)中
+// 没有的字从这里读, 读出的字模放在一个小的LRU缓存中. 每分钟重画的字大多在内置
+// 字库中, 不用读Flash; 节日与消息中的生僻字读过一次之后也不用再读.
+//
+// Flash的前0x3b000字节是固件与出厂信息, 字库放在0x40000之后(512KB的Flash).
+
+#define FSTORE_ADDR   0x40000
+#define FSTORE_SIZE   0x40000
+#define FSTORE_MAGIC  0x52545346  // "FSTR"
+#define FSTORE_HEAD   16
+#define FSTORE_ENTRY  5
+
+// 缓存的个数与每个字模的最大字节数(12点阵压缩后最多33字节)
+#ifndef FC_SLOTS
+#define FC_SLOTS  16
+#endif
+#define FC_DATA   36
+
+typedef struct {
+	u16 ucs;
+	u16 len;      // 0: Flash字库中也没有这个字
+	u32 used;     // 最近一次使用, 越小越旧
+	u32 data[FC_DATA/4];
+}FC_SLOT;
+
+static FC_SLOT fc_slot[FC_SLOTS];
+static u32 fc_tick;
+
+// 命中率统计
+static u32 fc_hit;
+static u32 fc_miss;
+
+static int fs_state;   // 0: 还没有检查 1: 有效 -1: 没有字库
+static int fs_flags;
+static int fs_count;
+
+
+static void fstore_init(void)
+{
+	u32 head[FSTORE_HEAD/4];
+	u8 *p = (u8*)head;
+	int gmax, size;
+
+	epd_bus->flash_read(FSTORE_ADDR, FSTORE_HEAD, p);
+	fs_flags = p[4] | (p[5]<<8);
+	fs_count = p[6] | (p[7]<<8);
+	gmax = p[8] | (p[9]<<8);
+	size = p[12] | (p[13]<<8) | (p[14]<<16) | (p[15]<<24);
+
+	fs_state = -1;
+	if(head[0]!=FSTORE_MAGIC)
+		return;
+	if(fs_count==0 || gmax>FC_DATA || size>FSTORE_SIZE){
+		printk("font store: bad header %d %d %d\n", fs_count, gmax, size);
+		return;
+	}
+	fs_state = 1;
+	printk("font store: %d glyphs, %d bytes\n", fs_count, size);
+}
+
+
+// 读索引中第k项开始的n项(最多2项)
+static u8 *fstore_index(int k, int n, u32 *buf)
+{
+	epd_bus->flash_read(FSTORE_ADDR+FSTORE_HEAD+k*FSTORE_ENTRY, n*FSTORE_ENTRY, (u8*)buf);
+	return (u8*)buf;
+}
+
+
+// 在Flash的索引中二分查找, 把字模读到slot中. 没有时len为0.
+static void fstore_load(FC_SLOT *slot, int ucs)
+{
+	u32 tmp[3];
+	u8 *p;
+	int lo, hi, mid, code, off, end;
+
+	slot->ucs = ucs;
+	slot->len = 0;
+
+	lo = 0;
+	hi = fs_count-1;
+	while(lo<=hi){
+		mid = (lo+hi)>>1;
+		p = fstore_index(mid, 1, tmp);
+		code = p[0] | (p[1]<<8);
+		if(code==ucs)
+			break;
+		if(code<ucs)
+			lo = mid+1;
+		else
+			hi = mid-1;
+	}
+	if(lo>hi)
+		return;
+
+	// 下一项的偏移就是这个字模的结尾(最后一项是结束标记)
+	p = fstore_index(mid, 2, tmp);
+	off = p[2] | (p[3]<<8) | (p[4]<<16);
+	end = p[7] | (p[8]<<8) | (p[9]<<16);
+	if(end-off<5 || end-off>FC_DATA)
+		return;
+
+	epd_bus->flash_read(FSTORE_ADDR+off, end-off, (u8*)slot->data);
+	slot->len = end-off;
+}
+
+
+// 返回ucs的字模(格式与字库中的相同), 没有时返回NULL. 返回的指针在下一次调用前有效.
+const u8 *fstore_find(int ucs)
+{
+	FC_SLOT *slot, *old;
+	int i;
+
+	if(fs_state==0)
+		fstore_init();
+	if(fs_state<0)
+		return NULL;
+
+	fc_tick += 1;
+	old = &fc_slot[0];
+	for(i=0; i<FC_SLOTS; i++){
+		slot = &fc_slot[i];
+		if(slot->used && slot->ucs==ucs){
+			fc_hit += 1;
+			slot->used = fc_tick;
+			return (slot->len)? (u8*)slot->data : NULL;
+		}
+		if(slot->used<old->used)
+			old = slot;
+	}
+
+	fc_miss += 1;
+	fstore_load(old, ucs);
+	old->used = fc_tick;
+	return (old->len)? (u8*)old->data : NULL;
+}
+
+
+// Flash字库的标志(同字库头的高4位), 用于绘制字模.
+int fstore_flags(void)
+{
+	return fs_flags;
+}
+
+
+void fstore_report(void)
+{
+	u32 total = fc_hit+fc_miss;
+
+	if(total==0)
+		return;
+	printk("font cache: %d hit, %d miss, %d%%\n", fc_hit, fc_miss, fc_hit*100/total);
+}
+
+
+/******************************************************************************/
+
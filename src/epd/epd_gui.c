@@ -10,7 +10,21 @@
 int fb_w;
 int fb_h;
 
-#define FB_SIZE 4096
+// 分条绘制(EPD_STRIP_LINES>0)时fb_bw/fb_rr只有一条(EPD_STRIP_LINES行), 绘图调用
+// 记录在显示列表中, 发送时逐条重放(fb_band). 否则是整屏的FB, 直接绘制.
+// fb_top是fb中第一行的原生y, 整屏时为0.
+#if EPD_STRIP_LINES
+#define FB_SIZE   (EPD_STRIP_LINES*16)  // 原生的一行最多16字节(128点)
+#define FB_TOP    fb_top
+#define FB_BOTTOM (fb_top+fb_rows-1)
+static int fb_rows;
+#else
+#define FB_SIZE   4096
+#define FB_TOP    0
+#define FB_BOTTOM (scr_h-1)
+#endif
+
+int fb_top;
 u8 fb_bw[FB_SIZE];
 u8 fb_rr[FB_SIZE];
 
@@ -18,67 +32,417 @@ u8 fb_rr[FB_SIZE];
 /******************************************************************************/
 
 
-void draw_pixel(int x, int y, int color)
+// 自上次rect_clear(&fb_dirty)以来改动过的区域. 只需把这部分发送给屏.
+RECT fb_dirty = {0x7fff, 0x7fff, -1, -1};
+
+// 红色平面是否有改动. 由epd_screen_update清除.
+int fb_red_dirty;
+
+
+void rect_clear(RECT *r)
 {
-	int nx, ny;
-	int rmode = scr_mode&0x03;
-	
+	r->x1 = 0x7fff;
+	r->y1 = 0x7fff;
+	r->x2 = -1;
+	r->y2 = -1;
+}
+
+
+int rect_empty(RECT *r)
+{
+	return r->x1>r->x2;
+}
+
+
+void rect_union(RECT *r, RECT *s)
+{
+	if(rect_empty(s))
+		return;
+
+	if(s->x1<r->x1) r->x1 = s->x1;
+	if(s->y1<r->y1) r->y1 = s->y1;
+	if(s->x2>r->x2) r->x2 = s->x2;
+	if(s->y2>r->y2) r->y2 = s->y2;
+}
+
+
+int rect_overlap(RECT *a, RECT *b)
+{
+	if(rect_empty(a) || rect_empty(b))
+		return 0;
+
+	return a->x1<=b->x2 && b->x1<=a->x2 && a->y1<=b->y2 && b->y1<=a->y2;
+}
+
+
+/******************************************************************************/
+
+#if EPD_STRIP_LINES
+
+// 显示列表: 一帧中的绘图调用按顺序记录在这里, 由fb_band逐条重放.
+// 文字与字串复制到条目后面; 位图只记指针, 必须在这一帧发送完之前保持有效.
+#ifndef DL_SIZE
+#define DL_SIZE  512
+#endif
+
+enum {
+	DL_FILL,     // fb_fill_rect: x,y,a,b是原生坐标的矩形
+	DL_PIXEL,
+	DL_BOX,      // draw_box: x,y,a,b是两个角
+	DL_BITMAP,   // draw_bitmap: a,b是宽高
+	DL_TEXT,     // draw_text: ptr是字库, 后面是UTF-8字串
+	DL_RUN,      // draw_glyph_run: ptr是字库, 后面是字模序号
+	DL_CACHE,    // 缓存的部件: x,y,a,b是原生矩形, ptr是像素
+};
+
+typedef struct {
+	u8  op;
+	u8  color;
+	u8  size;      // 整个条目的字节数, 4字节对齐
+	u8  resv;
+	short x, y, a, b;
+	const void *ptr;
+}DL_ITEM;
+
+static u32 dl_buf[DL_SIZE/4];
+static int dl_len;
+static int dl_replay;   // 正在重放, 绘图函数直接画
+static int dl_red;      // 这一帧有红色
+static int dl_red_last;
+static int dl_full;      // 这一帧有条目放不下, 画出的内容不完整
+
+// 为1时draw_text/draw_glyph_run只计算宽度, 不画
+static int fb_skip;
+
+static void fb_cache_blit(DL_ITEM *it);
+
+
+static void dl_clear(void)
+{
+	dl_len = 0;
+	fb_rows = 0;
+	dl_red_last = dl_red;
+	dl_red = 0;
+	dl_full = 0;
+}
+
+
+// 不在重放时记录一次绘图调用, 返回1. data不为NULL时把len字节复制到条目后面.
+// 放不下时丢掉这次调用, 并记下这一帧不完整(见fb_overflow).
+static int dl_record(int op, int color, int x, int y, int a, int b, const void *ptr, const void *data, int len)
+{
+	DL_ITEM *it;
+	int size;
+
+	if(dl_replay)
+		return 0;
+
+	// 当前条的内容就过时了
+	fb_rows = 0;
+
+	size = (sizeof(DL_ITEM)+len+3)&~3;
+	if(size>255 || dl_len+size>DL_SIZE){
+		printk("dl: full, op %d dropped\n", op);
+		dl_full = 1;
+		return 1;
+	}
+
+	it = (DL_ITEM*)((u8*)dl_buf+dl_len);
+	it->op = op;
+	it->color = color;
+	it->size = size;
+	it->x = x;
+	it->y = y;
+	it->a = a;
+	it->b = b;
+	it->ptr = ptr;
+	if(data)
+		memcpy(it+1, data, len);
+	dl_len += size;
+
+	if(color==RED){
+		dl_red = 1;
+		fb_red_dirty = 1;
+	}
+	return 1;
+}
+
+#endif
+
+
+#define FB_DIRTY(nx, ny) do{ \
+	if((nx)<fb_dirty.x1) fb_dirty.x1 = (nx); \
+	if((nx)>fb_dirty.x2) fb_dirty.x2 = (nx); \
+	if((ny)<fb_dirty.y1) fb_dirty.y1 = (ny); \
+	if((ny)>fb_dirty.y2) fb_dirty.y2 = (ny); \
+}while(0)
+
+
+// 清空整屏. 整屏都记为改动. 分条绘制时清空显示列表, 开始新的一帧.
+void fb_clear(void)
+{
+#if EPD_STRIP_LINES
+	dl_clear();
+	// 没有整屏的FB, 不能逐点比较红色平面: 上一帧或这一帧有红色时先记为有变化,
+	// 由epd_screen_diff按红色平面每一行的hash确定.
+	fb_red_dirty = dl_red_last;
+#else
+	memset(fb_bw, 0xff, scr_h*line_bytes);
+	memset(fb_rr, 0x00, scr_h*line_bytes);
+	fb_red_dirty = 1;
+#endif
+
+	fb_dirty.x1 = 0;
+	fb_dirty.y1 = 0;
+	fb_dirty.x2 = line_bytes*8-1;
+	fb_dirty.y2 = scr_h-1;
+}
+
+
+// 把一行中x1..x2的位置1(set)或清0. 返回是否有改动.
+static int fb_span(u8 *line, int x1, int x2, int set)
+{
+	int b1 = x1>>3;
+	int b2 = x2>>3;
+	int m1 = 0xff>>(x1&7);
+	int m2 = (0xff<<(7-(x2&7)))&0xff;
+	int v = (set)? 0xff: 0x00;
+	int i, old, changed;
+
+	if(b1==b2)
+		m1 &= m2;
+
+	old = line[b1];
+	line[b1] = (old&~m1) | (v&m1);
+	changed = (line[b1]!=old);
+	if(b1==b2)
+		return changed;
+
+	if(changed==0){
+		for(i=b1+1; i<b2; i++){
+			if(line[i]!=v){
+				changed = 1;
+				break;
+			}
+		}
+	}
+	if(b2>b1+1)
+		memset(line+b1+1, v, b2-b1-1);
+
+	old = line[b2];
+	line[b2] = (old&~m2) | (v&m2);
+	changed |= (line[b2]!=old);
+
+	return changed;
+}
+
+
+// 用color填充一块区域(原生坐标). 逐字节写, 不逐点调用draw_pixel.
+void fb_fill_rect(RECT *r, int color)
+{
+	RECT c = *r;
+	int y, set_bw, set_rr;
+
+#if EPD_STRIP_LINES
+	if(dl_record(DL_FILL, color, r->x1, r->y1, r->x2, r->y2, NULL, NULL, 0))
+		return;
+#endif
+
+	// 限制在FB之内
+	if(c.x1<0) c.x1 = 0;
+	if(c.y1<FB_TOP) c.y1 = FB_TOP;
+	if(c.x2>line_bytes*8-1) c.x2 = line_bytes*8-1;
+	if(c.y2>FB_BOTTOM) c.y2 = FB_BOTTOM;
+	if(c.x1>c.x2 || c.y1>c.y2)
+		return;
+
+	set_bw = (color==WHITE);
+	set_rr = (color==RED);
+
+	for(y=c.y1; y<=c.y2; y++){
+		fb_span(fb_bw+(y-FB_TOP)*line_bytes, c.x1, c.x2, set_bw);
+		if(scr_mode&EPD_BWR){
+			if(fb_span(fb_rr+(y-FB_TOP)*line_bytes, c.x1, c.x2, set_rr))
+				fb_red_dirty = 1;
+		}
+	}
+
+	rect_union(&fb_dirty, &c);
+}
+
+
+// 清空一块区域(原生坐标), 用于擦掉上次画的内容.
+void fb_clear_rect(RECT *r)
+{
+	fb_fill_rect(r, WHITE);
+}
+
+
+/******************************************************************************/
+
+// 绘图内核. scr_mode在epd_hw_init之后就不变了, 这里为每种旋转/镜像/三色组合
+// 生成一组专用的函数(mode是常量, 编译器会去掉多余的分支), 初始化时选定一组.
+// 只用一种屏时可以定义EPD_FIXED_MODE(如ROTATE_3|EPD_BWR), 只编译这一组.
+
+#ifdef __CC_ARM
+#define FB_INLINE  static __forceinline
+#else
+#define FB_INLINE  static inline __attribute__((always_inline))
+#endif
+
+
+// 屏幕坐标转为原生坐标(fb_bw/fb_rr中的位置)
+FB_INLINE void fb_map_t(int x, int y, int *nx, int *ny, const int mode)
+{
+	int rmode = mode&0x03;
+
 	if(rmode==0){
-		nx = x;
-		ny = y;
+		*nx = x;
+		*ny = y;
 	}else if(rmode==1){
-		nx = scr_w-1-y;
-		ny = x;
+		*nx = scr_w-1-y;
+		*ny = x;
 	}else if(rmode==2){
-		nx = scr_w-1-x;
-		ny = scr_h-1-y;
-	}else if(rmode==3){
-		nx = y;
-		ny = scr_h-1-x;
+		*nx = scr_w-1-x;
+		*ny = scr_h-1-y;
+	}else{
+		*nx = y;
+		*ny = scr_h-1-x;
 	}
-	if(scr_mode&MIRROR_H){
-		nx += scr_padding;
+	if(mode&MIRROR_H){
+		*nx += scr_padding;
 	}
+}
+
 
-	int byte_pos = ny*line_bytes+(nx>>3);
+FB_INLINE void fb_pixel_t(int x, int y, int color, const int mode)
+{
+	int nx, ny;
+
+	fb_map_t(x, y, &nx, &ny, mode);
+	if(nx<0 || nx>=line_bytes*8 || ny<FB_TOP || ny>FB_BOTTOM)
+		return;
+
+	int byte_pos = (ny-FB_TOP)*line_bytes+(nx>>3);
 	int bit_mask = 0x80>>(nx&7);
 
+	// WHITE也要写入, 这样才能在不清空整屏的情况下覆盖旧内容.
 	if(color!=WHITE){
 		fb_bw[byte_pos] &= ~bit_mask;
+	}else{
+		fb_bw[byte_pos] |=  bit_mask;
 	}
-	if(scr_mode&EPD_BWR && color==RED){
-		fb_rr[byte_pos] |=  bit_mask;
+	if(mode&EPD_BWR){
+		int rr = fb_rr[byte_pos];
+		if(color==RED){
+			rr |=  bit_mask;
+		}else{
+			rr &= ~bit_mask;
+		}
+		if(rr!=fb_rr[byte_pos]){
+			fb_rr[byte_pos] = rr;
+			fb_red_dirty = 1;
+		}
 	}
+
+	FB_DIRTY(nx, ny);
+}
+
+
+typedef struct {
+	void (*map)(int x, int y, int *nx, int *ny);
+	void (*pixel)(int x, int y, int color);
+}FB_KERNEL;
+
+#define FB_KERNEL_DEF(name, mode) \
+	static void fb_map_##name(int x, int y, int *nx, int *ny) { fb_map_t(x, y, nx, ny, (mode)); } \
+	static void fb_pixel_##name(int x, int y, int color) { fb_pixel_t(x, y, color, (mode)); }
+
+#define FB_KERNEL(name)  {fb_map_##name, fb_pixel_##name}
+
+
+#ifdef EPD_FIXED_MODE
+
+FB_KERNEL_DEF(fixed, EPD_FIXED_MODE)
+
+static const FB_KERNEL fb_kernel = FB_KERNEL(fixed);
+
+void fb_select_kernel(void)
+{
+	if((scr_mode&(EPD_BWR|MIRROR_H|0x03))!=((EPD_FIXED_MODE)&(EPD_BWR|MIRROR_H|0x03)))
+		printk("fb: scr_mode %02x, but built for %02x!\n", scr_mode, EPD_FIXED_MODE);
+}
+
+#define fb_map    fb_kernel.map
+#define fb_pixel  fb_kernel.pixel
+
+#else
+
+// 名字中的数字: 旋转, 后缀m: MIRROR_H, r: EPD_BWR
+FB_KERNEL_DEF(0,    ROTATE_0)
+FB_KERNEL_DEF(1,    ROTATE_1)
+FB_KERNEL_DEF(2,    ROTATE_2)
+FB_KERNEL_DEF(3,    ROTATE_3)
+FB_KERNEL_DEF(0m,   ROTATE_0|MIRROR_H)
+FB_KERNEL_DEF(1m,   ROTATE_1|MIRROR_H)
+FB_KERNEL_DEF(2m,   ROTATE_2|MIRROR_H)
+FB_KERNEL_DEF(3m,   ROTATE_3|MIRROR_H)
+FB_KERNEL_DEF(0r,   ROTATE_0|EPD_BWR)
+FB_KERNEL_DEF(1r,   ROTATE_1|EPD_BWR)
+FB_KERNEL_DEF(2r,   ROTATE_2|EPD_BWR)
+FB_KERNEL_DEF(3r,   ROTATE_3|EPD_BWR)
+FB_KERNEL_DEF(0mr,  ROTATE_0|MIRROR_H|EPD_BWR)
+FB_KERNEL_DEF(1mr,  ROTATE_1|MIRROR_H|EPD_BWR)
+FB_KERNEL_DEF(2mr,  ROTATE_2|MIRROR_H|EPD_BWR)
+FB_KERNEL_DEF(3mr,  ROTATE_3|MIRROR_H|EPD_BWR)
+
+// 下标: 旋转 | MIRROR_H<<2 | EPD_BWR<<3
+static const FB_KERNEL fb_kernels[16] = {
+	FB_KERNEL(0),  FB_KERNEL(1),  FB_KERNEL(2),  FB_KERNEL(3),
+	FB_KERNEL(0m), FB_KERNEL(1m), FB_KERNEL(2m), FB_KERNEL(3m),
+	FB_KERNEL(0r), FB_KERNEL(1r), FB_KERNEL(2r), FB_KERNEL(3r),
+	FB_KERNEL(0mr),FB_KERNEL(1mr),FB_KERNEL(2mr),FB_KERNEL(3mr),
+};
+
+static const FB_KERNEL *fb_kernel = &fb_kernels[0];
+
+// 由epd_hw_init调用
+void fb_select_kernel(void)
+{
+	int id = scr_mode&0x03;
+
+	if(scr_mode&MIRROR_H)
+		id |= 4;
+	if(scr_mode&EPD_BWR)
+		id |= 8;
+	fb_kernel = &fb_kernels[id];
+}
+
+#define fb_map    fb_kernel->map
+#define fb_pixel  fb_kernel->pixel
+
+#endif
+
+
+void draw_pixel(int x, int y, int color)
+{
+#if EPD_STRIP_LINES
+	if(dl_record(DL_PIXEL, color, x, y, 0, 0, NULL, NULL, 0))
+		return;
+#endif
+	fb_pixel(x, y, color);
 }
 
 
 void draw_hline(int y, int x1, int x2, int color)
 {
-	int x;
-	if(x1>x2){
-		x = x1;
-		x1 = x2;
-		x2 = x;
-	}
-	
-	for(x=x1; x<=x2; x+=1){
-		draw_pixel(x, y, color);
-	}
+	draw_box(x1, y, x2, y, color);
 }
 
 
 void draw_vline(int x, int y1, int y2, int color)
 {
-	int y;
-	if(y1>y2){
-		x = y1;
-		y1 = y2;
-		y2 = x;
-	}
-	
-	for(y=y1; y<=y2; y+=1){
-		draw_pixel(x, y, color);
-	}
+	draw_box(x, y1, x, y2, color);
 }
 
 
@@ -91,88 +455,418 @@ void draw_rect(int x1, int y1, int x2, int y2, int color)
 }
 
 
+// 两个角转换为原生坐标后整块填充.
 void draw_box(int x1, int y1, int x2, int y2, int color)
 {
-	int y;
-	
-	for(y=y1; y<=y2; y++){
-		draw_hline(y, x1, x2, color);
+	RECT r;
+	int t;
+
+#if EPD_STRIP_LINES
+	if(dl_record(DL_BOX, color, x1, y1, x2, y2, NULL, NULL, 0))
+		return;
+#endif
+
+	fb_map(x1, y1, &x1, &y1);
+	fb_map(x2, y2, &x2, &y2);
+	if(x1>x2){
+		t = x1;
+		x1 = x2;
+		x2 = t;
+	}
+	if(y1>y2){
+		t = y1;
+		y1 = y2;
+		y2 = t;
 	}
+
+	r.x1 = x1;
+	r.y1 = y1;
+	r.x2 = x2;
+	r.y2 = y2;
+	fb_fill_rect(&r, color);
 }
 
 /******************************************************************************/
 
 
+// 按color写一个字节中mask为1的位.
+static void fb_put(int pos, int mask, int color)
+{
+	if(color!=WHITE){
+		fb_bw[pos] &= ~mask;
+	}else{
+		fb_bw[pos] |=  mask;
+	}
+	if(scr_mode&EPD_BWR){
+		int rr = fb_rr[pos];
+		if(color==RED){
+			rr |=  mask;
+		}else{
+			rr &= ~mask;
+		}
+		if(rr!=fb_rr[pos]){
+			fb_rr[pos] = rr;
+			fb_red_dirty = 1;
+		}
+	}
+}
+
+
+// 把bits中从第b0位开始的n位(高位在前)画到原生坐标(nx, ny)开始的一行上. 为0的位不画.
+static void fb_put_bits(int nx, int ny, const u8 *bits, int b0, int n, int color)
+{
+	int pos = (ny-FB_TOP)*line_bytes+(nx>>3);
+	int s = nx&7;
+	int v, m;
+
+	while(n>0){
+		// 取出8位
+		v = bits[b0>>3]<<(b0&7);
+		if((b0&7) && n>8-(b0&7))
+			v |= bits[(b0>>3)+1]>>(8-(b0&7));
+		v &= 0xff;
+		if(n<8)
+			v &= 0xff<<(8-n);
+
+		// 写到目标的一个或两个字节中
+		m = v>>s;
+		if(m)
+			fb_put(pos, m, color);
+		m = (v<<(8-s))&0xff;
+		if(m)
+			fb_put(pos+1, m, color);
+
+		pos += 1;
+		b0 += 8;
+		n -= 8;
+	}
+}
+
+
+// 8x8位转置: t[j]的第7-i位 = a[i]的第7-j位.
+static void fb_transpose8(const u8 *a, u8 *t)
+{
+	u32 x, y, z;
+
+	x = (a[0]<<24) | (a[1]<<16) | (a[2]<<8) | a[3];
+	y = (a[4]<<24) | (a[5]<<16) | (a[6]<<8) | a[7];
+
+	z = (x ^ (x>> 7)) & 0x00aa00aa;  x = x ^ z ^ (z<< 7);
+	z = (y ^ (y>> 7)) & 0x00aa00aa;  y = y ^ z ^ (z<< 7);
+	z = (x ^ (x>>14)) & 0x0000cccc;  x = x ^ z ^ (z<<14);
+	z = (y ^ (y>>14)) & 0x0000cccc;  y = y ^ z ^ (z<<14);
+	z = (x & 0xf0f0f0f0) | ((y>>4) & 0x0f0f0f0f);
+	y = ((x<<4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+	x = z;
+
+	t[0] = x>>24; t[1] = x>>16; t[2] = x>>8; t[3] = x;
+	t[4] = y>>24; t[5] = y>>16; t[6] = y>>8; t[7] = y;
+}
+
+
+static int fb_rev8(int v)
+{
+	v = ((v&0xf0)>>4) | ((v&0x0f)<<4);
+	v = ((v&0xcc)>>2) | ((v&0x33)<<2);
+	v = ((v&0xaa)>>1) | ((v&0x55)<<1);
+	return v;
+}
+
+
+// 旋转90/270度且不需要裁剪的位图: 按8x8的块转置, 位图的一列成为原生的一行.
+// (ax, ay)是位图(0,0)的原生坐标. 位图的列加1时原生y变化uy, 行加1时原生x变化vx.
+static void fb_blit_rotated(int ax, int ay, int uy, int vx, int w, int h, const u8 *bits, int color)
+{
+	int lsize = (w+7)/8;
+	int rb, cb, i, j, col;
+	u8 a[8], t[8], v;
+
+	for(rb=0; rb<h; rb+=8){
+		for(cb=0; cb<lsize; cb++){
+			for(i=0; i<8; i++)
+				a[i] = (rb+i<h)? bits[(rb+i)*lsize+cb] : 0;
+			fb_transpose8(a, t);
+
+			for(j=0; j<8; j++){
+				col = cb*8+j;
+				if(t[j]==0 || col>=w)
+					continue;
+				// 超出位图的位都是0, 不会写到屏外.
+				if(vx>0){
+					fb_put_bits(ax+rb, ay+col*uy, &t[j], 0, 8, color);
+				}else{
+					v = fb_rev8(t[j]);
+					fb_put_bits(ax-rb-7, ay+col*uy, &v, 0, 8, color);
+				}
+			}
+		}
+	}
+}
+
+
+// 画一个w*h的位图(字模或图标). 每行(w+7)/8字节, 高位在前, 为0的位不画.
+// 先把整个位图的范围转为原生坐标并裁剪, 再逐行写入. 原生的行与位图的行同向时
+// 直接移位写入; 旋转了90/270度时按8x8块转置; 其它情况(左右颠倒或被裁剪的旋转位图)
+// 先把一行的位收集起来再写.
+void draw_bitmap(int x, int y, int w, int h, const u8 *bits, int color)
+{
+	int lsize = (w+7)/8;
+	int ax, ay, bx, by, ux, uy, vx, vy;
+	int nx, ny, n, k, i, col, row, dc, dr;
+	u8 tmp[8];
+	RECT c;
+
+	if(w<=0 || h<=0)
+		return;
+#if EPD_STRIP_LINES
+	if(dl_record(DL_BITMAP, color, x, y, w, h, bits, NULL, 0))
+		return;
+#endif
+
+	// 位图(0,0)的原生坐标, 以及位图的列/行加1时原生坐标的变化
+	fb_map(x, y, &ax, &ay);
+	fb_map(x+1, y, &ux, &uy);
+	fb_map(x, y+1, &vx, &vy);
+	fb_map(x+w-1, y+h-1, &bx, &by);
+	ux -= ax; uy -= ay;
+	vx -= ax; vy -= ay;
+
+	c.x1 = (ax<bx)? ax: bx;
+	c.x2 = (ax<bx)? bx: ax;
+	c.y1 = (ay<by)? ay: by;
+	c.y2 = (ay<by)? by: ay;
+
+	if(ux==0 && c.x1>=0 && c.y1>=FB_TOP && c.x2<line_bytes*8 && c.y2<=FB_BOTTOM){
+		fb_blit_rotated(ax, ay, uy, vx, w, h, bits, color);
+		rect_union(&fb_dirty, &c);
+		return;
+	}
+
+	if(c.x1<0) c.x1 = 0;
+	if(c.y1<FB_TOP) c.y1 = FB_TOP;
+	if(c.x2>line_bytes*8-1) c.x2 = line_bytes*8-1;
+	if(c.y2>FB_BOTTOM) c.y2 = FB_BOTTOM;
+	if(c.x1>c.x2 || c.y1>c.y2)
+		return;
+
+	for(ny=c.y1; ny<=c.y2; ny++){
+		// 这一行第一个点在位图中的位置, 以及沿原生x方向的步长
+		if(ux){
+			col = (c.x1-ax)*ux;
+			row = (ny-ay)*vy;
+			dc = ux;
+			dr = 0;
+		}else{
+			col = (ny-ay)*uy;
+			row = (c.x1-ax)*vx;
+			dc = 0;
+			dr = vx;
+		}
+
+		n = c.x2-c.x1+1;
+		if(dc==1){
+			fb_put_bits(c.x1, ny, bits+row*lsize, col, n, color);
+			continue;
+		}
+
+		nx = c.x1;
+		while(n>0){
+			k = (n>64)? 64: n;
+			memset(tmp, 0, sizeof(tmp));
+			for(i=0; i<k; i++){
+				if(bits[row*lsize+(col>>3)]&(0x80>>(col&7)))
+					tmp[i>>3] |= 0x80>>(i&7);
+				col += dc;
+				row += dr;
+			}
+			fb_put_bits(nx, ny, tmp, 0, k, color);
+			nx += k;
+			n -= k;
+		}
+	}
+
+	rect_union(&fb_dirty, &c);
+}
+
+
+/******************************************************************************/
+
+
 #include "sfont.h"
 #include "font56.h"
 
-u8 *current_font = (u8*)sfont;
+// 固定字串(ui_glyphs.h)中是sfont的字模序号, 换了字库而没有重新生成时画出的是别的字.
+#define GR_SIZE_ONLY
+#include "../ui_glyphs.h"
+typedef char ui_glyphs_check[(GR_FONT_SIZE==sfont_size)? 1: -1];
+
+// 字库头中个数的高4位是标志(格式见tools/fontc.py)
+#define FONT_ROTATED    0x8000
+#define FONT_RLE        0x4000
+#define FONT_ROT(h)     (((h)>>12)&3)
+#define FONT_COUNT(h)   ((h)&0x0fff)
+
+const u8 *current_font = sfont;
 
 int select_font(int id)
 {
 	if(id==0)
-		current_font = (u8*)sfont;
+		current_font = sfont;
 	else
-		current_font = (u8*)F_DSEG7_56;
+		current_font = F_DSEG7_56;
 	
 	return 0;
 }
 
 
-static u8 *find_font(u8 *font, int ucs)
+// 字库的索引按编码排序(格式见tools/fontc.py). 开头编码连续的一段(ASCII)直接定位,
+// 其余的二分查找.
+static const u8 *find_font(const u8 *font, int ucs)
 {
-	int total = *(u16*)font;
-	int i;
+	int total = FONT_COUNT(*(const u16*)font);
+	const u16 *index = (const u16*)(font+2);
+	int lo, hi, mid;
 
-	for(i=0; i<total; i++){
-		if(*(u16*)(font+2+i*4+0)==ucs){
-			int offset = *(u16*)(font+2+i*4+2);
-			//printk("  %04x at %04x\n", ucs, offset);
-			return font+offset;
-		}
+	mid = ucs-index[0];
+	if(mid>=0 && mid<total && index[mid*2]==ucs)
+		return font+index[mid*2+1];
+
+	lo = 0;
+	hi = total-1;
+	while(lo<=hi){
+		mid = (lo+hi)>>1;
+		if(index[mid*2]==ucs)
+			return font+index[mid*2+1];
+		if(index[mid*2]<ucs)
+			lo = mid+1;
+		else
+			hi = mid-1;
 	}
 
 	return NULL;
 }
 
 
-int fb_draw_font(int x, int y, int ucs, int color)
+// 画一个按rot方向预先旋转过的w*h位图(原生坐标排列, 见tools/fontc.py).
+// 与屏的方向相同时, 每个原生行直接移位写入; 不同时逐点画.
+// rle: 位图前有每行1位的重复标志, 重复的行不存放. 逐行移动指针, 不用先解压.
+static void fb_draw_rotated(int x, int y, int w, int h, const u8 *bits, int rot, int rle, int color)
 {
-	int r, c;
-	u8 *font_data = find_font(current_font, ucs);
-	if(font_data==NULL){
-		printk("fb_draw %04x: not found!\n");
-		font_data = find_font(current_font, '?');
+	int ax, ay, bx, by, nw, nh, lsize, ny, i, j, c, r;
+	const u8 *rep, *line;
+	RECT n, k;
+
+	nw = (rot&1)? h: w;
+	nh = (rot&1)? w: h;
+	lsize = (nw+7)/8;
+	rep = bits;
+	if(rle)
+		bits += (nh+7)/8;
+
+	if(rot!=(scr_mode&0x03)){
+		line = bits;
+		for(j=0; j<nh; j++){
+			if(j && !(rle && (rep[j>>3]&(0x80>>(j&7)))))
+				line += lsize;
+			for(i=0; i<nw; i++){
+				if((line[i>>3]&(0x80>>(i&7)))==0)
+					continue;
+				if(rot==0){
+					c = i;     r = j;
+				}else if(rot==1){
+					c = j;     r = h-1-i;
+				}else if(rot==2){
+					c = w-1-i; r = h-1-j;
+				}else{
+					c = w-1-j; r = i;
+				}
+				draw_pixel(x+c, y+r, color);
+			}
+		}
+		return;
 	}
 
+	fb_map(x, y, &ax, &ay);
+	fb_map(x+w-1, y+h-1, &bx, &by);
+	n.x1 = (ax<bx)? ax: bx;
+	n.x2 = (ax<bx)? bx: ax;
+	n.y1 = (ay<by)? ay: by;
+	n.y2 = (ay<by)? by: ay;
+
+	k = n;
+	if(k.x1<0) k.x1 = 0;
+	if(k.y1<FB_TOP) k.y1 = FB_TOP;
+	if(k.x2>line_bytes*8-1) k.x2 = line_bytes*8-1;
+	if(k.y2>FB_BOTTOM) k.y2 = FB_BOTTOM;
+	if(k.x1>k.x2 || k.y1>k.y2)
+		return;
+
+	if(rle==0){
+		for(ny=k.y1; ny<=k.y2; ny++){
+			fb_put_bits(k.x1, ny, bits+(ny-n.y1)*lsize, k.x1-n.x1, k.x2-k.x1+1, color);
+		}
+	}else{
+		// 被裁掉的行也要走一遍重复标志
+		line = bits;
+		for(ny=n.y1; ny<=k.y2; ny++){
+			j = ny-n.y1;
+			if(j && !(rep[j>>3]&(0x80>>(j&7))))
+				line += lsize;
+			if(ny>=k.y1)
+				fb_put_bits(k.x1, ny, line, k.x1-n.x1, k.x2-k.x1+1, color);
+		}
+	}
+
+	rect_union(&fb_dirty, &k);
+}
+
+
+// 画一个字模, 返回前进的宽度. head是字库头(只用到标志).
+static int fb_draw_glyph(int x, int y, int head, const u8 *font_data, int color)
+{
 	int ft_adv = font_data[0];
 	int ft_bw = font_data[1];
 	int ft_bh = font_data[2];
 	int ft_bx = (signed char)font_data[3];
 	int ft_by = (signed char)font_data[4];
-	int ft_lsize = (ft_bw+7)/8;
-	font_data += 5;
-
-	x += ft_bx;
-	y += ft_by;
-
-	for (r=0; r<ft_bh; r++) {
-		for (c=0; c<ft_bw; c++) {
-			int b = font_data[c>>3];
-			int mask = 0x80>>(c%8);
-			if(b&mask){
-				draw_pixel(x+c, y, color);
-			}
-			mask >>= 1;
-		}
-		font_data += ft_lsize;
-		y += 1;
-	}
+
+#if EPD_STRIP_LINES
+	if(fb_skip)
+		return ft_adv;
+#endif
+	// 压缩的字库总是按原生坐标排列, 没有旋转标志时就是ROTATE_0
+	if(head&(FONT_ROTATED|FONT_RLE))
+		fb_draw_rotated(x+ft_bx, y+ft_by, ft_bw, ft_bh, font_data+5,
+						(head&FONT_ROTATED)? FONT_ROT(head): 0, head&FONT_RLE, color);
+	else
+		draw_bitmap(x+ft_bx, y+ft_by, ft_bw, ft_bh, font_data+5, color);
 
 	return ft_adv;
 }
 
 
+int fb_draw_font(int x, int y, int ucs, int color)
+{
+	const u8 *font_data = find_font(current_font, ucs);
+	int head = *(const u16*)current_font;
+
+	// 小字库中没有的字从Flash字库中找
+	if(font_data==NULL && current_font==sfont){
+		font_data = fstore_find(ucs);
+		head = fstore_flags();
+	}
+	if(font_data==NULL){
+		printk("fb_draw %04x: not found!\n", ucs);
+		font_data = find_font(current_font, '?');
+		head = *(const u16*)current_font;
+		if(font_data==NULL)
+			return 0;
+	}
+
+	return fb_draw_glyph(x, y, head, font_data, color);
+}
+
+
 static int utf8_to_ucs(char **ustr)
 {
 	u8 *str = (u8*)*ustr;
@@ -195,18 +889,292 @@ static int utf8_to_ucs(char **ustr)
 }
 
 
-void draw_text(int x, int y, char *str, int color)
+// 返回文字结束处的x.
+int draw_text(int x, int y, char *str, int color)
 {
 	int ch;
 
+#if EPD_STRIP_LINES
+	// 记录下来, 这里只算出结束处的x
+	fb_skip = dl_record(DL_TEXT, color, x, y, 0, 0, current_font, str, strlen(str)+1);
+#endif
+
 	while(1){
 		ch = utf8_to_ucs(&str);
 		if(ch==0)
 			break;
 		x += fb_draw_font(x, y, ch, color);
 	}
+
+#if EPD_STRIP_LINES
+	fb_skip = 0;
+#endif
+	return x;
+}
+
+
+// 画预先转换好的字串(见tools/fontc.py strings): run中是sfont中字模的序号,
+// 不用解码UTF-8, 也不用查找. 返回结束处的x.
+int draw_glyph_run(int x, int y, const u16 *run, int color)
+{
+	const u8 *font = current_font;
+	int head = *(const u16*)font;
+	int total = FONT_COUNT(head);
+	const u16 *index = (const u16*)(font+2);
+
+	// 字串是按sfont生成的, 用别的字库画出的是错的字
+	if(font!=sfont){
+		printk("draw_glyph_run: current font is not sfont!\n");
+		return x;
+	}
+
+#if EPD_STRIP_LINES
+	const u16 *end = run;
+	while(*end!=GR_END)
+		end += 1;
+	fb_skip = dl_record(DL_RUN, color, x, y, 0, 0, font, run, (end-run+1)*2);
+#endif
+
+	while(*run!=GR_END){
+		if(*run<total)
+			x += fb_draw_glyph(x, y, head, font+index[*run*2+1], color);
+		run += 1;
+	}
+
+#if EPD_STRIP_LINES
+	fb_skip = 0;
+#endif
+	return x;
+}
+
+
+#if EPD_STRIP_LINES
+
+// 把显示列表中[from, to)的条目画到从原生第y行开始的n行中. 不改变fb_dirty与
+// fb_red_dirty, 它们描述的是这一帧记录下来的内容.
+static void dl_render(int y, int n, int from, int to)
+{
+	RECT dirty = fb_dirty;
+	int red_dirty = fb_red_dirty;
+	const u8 *font = current_font;
+	DL_ITEM *it;
+	int pos;
+
+	fb_top = y;
+	fb_rows = n;
+	memset(fb_bw, 0xff, n*line_bytes);
+	memset(fb_rr, 0x00, n*line_bytes);
+
+	dl_replay = 1;
+	for(pos=from; pos<to; pos+=it->size){
+		it = (DL_ITEM*)((u8*)dl_buf+pos);
+		switch(it->op){
+		case DL_FILL:
+		{
+			RECT r = {it->x, it->y, it->a, it->b};
+			fb_fill_rect(&r, it->color);
+			break;
+		}
+		case DL_PIXEL:
+			draw_pixel(it->x, it->y, it->color);
+			break;
+		case DL_BOX:
+			draw_box(it->x, it->y, it->a, it->b, it->color);
+			break;
+		case DL_BITMAP:
+			draw_bitmap(it->x, it->y, it->a, it->b, it->ptr, it->color);
+			break;
+		case DL_TEXT:
+			current_font = it->ptr;
+			draw_text(it->x, it->y, (char*)(it+1), it->color);
+			break;
+		case DL_RUN:
+			current_font = it->ptr;
+			draw_glyph_run(it->x, it->y, (const u16*)(it+1), it->color);
+			break;
+		case DL_CACHE:
+			fb_cache_blit(it);
+			break;
+		}
+	}
+	dl_replay = 0;
+
+	current_font = font;
+	fb_dirty = dirty;
+	fb_red_dirty = red_dirty;
+}
+
+
+// 保证原生第y行在fb中(需要时重放显示列表), 返回从y开始在fb中的行数.
+int fb_band(int y)
+{
+	int n;
+
+	if(fb_rows==0 || y<fb_top || y>=fb_top+fb_rows){
+		n = scr_h-y;
+		if(n>EPD_STRIP_LINES)
+			n = EPD_STRIP_LINES;
+		dl_render(y, n, 0, dl_len);
+	}
+
+	return fb_top+fb_rows-y;
+}
+
+
+// 这一帧(从fb_clear开始)是否有绘图调用因为显示列表放不下而丢掉了.
+// 这时画出的内容不完整, 不应发送.
+int fb_overflow(void)
+{
+	return dl_full;
+}
+
+
+/******************************************************************************/
+
+// 部件缓存(见epd_widget.c): 内容很少变的部件画好一次后存下原生矩形中的像素,
+// 之后每一帧只在显示列表中放一个DL_CACHE, 逐条重放时直接合成, 不再解码文字.
+// 缓存按墨迹合成(白色不覆盖下面的内容), 与文字和位图的透明绘制一致, 所以部件
+// 的范围可以和别的部件重叠. 黑白平面之后是红色平面(三色屏).
+#ifndef FB_CACHE_SIZE
+#define FB_CACHE_SIZE  2560
+#endif
+
+static u32 fb_cache_pool[FB_CACHE_SIZE/4];
+static int fb_cache_used;
+
+
+static int fb_cache_bytes(RECT *r)
+{
+	int size = ((r->x2>>3)-(r->x1>>3)+1)*(r->y2-r->y1+1);
+
+	if(scr_mode&EPD_BWR)
+		size *= 2;
+	return (size+3)&~3;
+}
+
+
+// 为屏幕坐标的范围(x, y, w, h)分配缓存, r返回原生矩形. 空间不够时返回NULL.
+// 缓存按屏的方向分配, 要在epd_hw_init之后调用.
+u8 *fb_cache_alloc(int x, int y, int w, int h, RECT *r)
+{
+	int ax, ay, bx, by, size;
+	u8 *bits;
+
+	fb_map(x, y, &ax, &ay);
+	fb_map(x+w-1, y+h-1, &bx, &by);
+	r->x1 = (ax<bx)? ax: bx;
+	r->x2 = (ax<bx)? bx: ax;
+	r->y1 = (ay<by)? ay: by;
+	r->y2 = (ay<by)? by: ay;
+	if(r->x1<0) r->x1 = 0;
+	if(r->y1<0) r->y1 = 0;
+	if(r->x2>line_bytes*8-1) r->x2 = line_bytes*8-1;
+	if(r->y2>scr_h-1) r->y2 = scr_h-1;
+	if(r->x1>r->x2 || r->y1>r->y2)
+		return NULL;
+
+	size = fb_cache_bytes(r);
+	if(fb_cache_used+size>FB_CACHE_SIZE){
+		printk("fb_cache: no room for %d bytes\n", size);
+		return NULL;
+	}
+	bits = (u8*)fb_cache_pool+fb_cache_used;
+	fb_cache_used += size;
+	return bits;
+}
+
+
+// 开始记录一个要缓存的部件, 返回显示列表中的位置.
+int fb_cache_begin(void)
+{
+	return dl_len;
+}
+
+
+// 把mark之后记录的条目画好存入bits, 换成一个DL_CACHE条目.
+void fb_cache_end(int mark, RECT *r, u8 *bits)
+{
+	int bytes = (r->x2>>3)-(r->x1>>3)+1;
+	int rows = r->y2-r->y1+1;
+	u8 *rr = bits+bytes*rows;
+	int y, n, i;
+
+	for(y=r->y1; y<=r->y2; y+=n){
+		n = r->y2-y+1;
+		if(n>EPD_STRIP_LINES)
+			n = EPD_STRIP_LINES;
+		dl_render(y, n, mark, dl_len);
+		for(i=0; i<n; i++){
+			memcpy(bits+(y-r->y1+i)*bytes, fb_bw+i*line_bytes+(r->x1>>3), bytes);
+			if(scr_mode&EPD_BWR)
+				memcpy(rr+(y-r->y1+i)*bytes, fb_rr+i*line_bytes+(r->x1>>3), bytes);
+		}
+	}
+
+	dl_len = mark;
+	fb_cache_put(r, bits);
+}
+
+
+// 在显示列表中放入一个缓存好的部件. 缓存中有红色时按红色记录(见fb_clear).
+void fb_cache_put(RECT *r, u8 *bits)
+{
+	int size = ((r->x2>>3)-(r->x1>>3)+1)*(r->y2-r->y1+1);
+	int color = BLACK;
+	int i;
+
+	if(scr_mode&EPD_BWR){
+		for(i=0; i<size; i++){
+			if(bits[size+i]){
+				color = RED;
+				break;
+			}
+		}
+	}
+	dl_record(DL_CACHE, color, r->x1, r->y1, r->x2, r->y2, bits, NULL, 0);
+}
+
+
+// 重放DL_CACHE: 缓存中黑白平面为0(有墨迹)的位置写入缓存的像素.
+static void fb_cache_blit(DL_ITEM *it)
+{
+	int bytes = (it->a>>3)-(it->x>>3)+1;
+	int rows = it->b-it->y+1;
+	const u8 *bw = (const u8*)it->ptr;
+	const u8 *rr = bw+bytes*rows;
+	int y1 = (it->y>FB_TOP)? it->y: FB_TOP;
+	int y2 = (it->b<FB_BOTTOM)? it->b: FB_BOTTOM;
+	int y, i, k;
+	u8 *d;
+
+	for(y=y1; y<=y2; y++){
+		k = (y-it->y)*bytes;
+		d = fb_bw+(y-FB_TOP)*line_bytes+(it->x>>3);
+		for(i=0; i<bytes; i++)
+			d[i] &= bw[k+i];
+		if(scr_mode&EPD_BWR){
+			d = fb_rr+(y-FB_TOP)*line_bytes+(it->x>>3);
+			for(i=0; i<bytes; i++)
+				d[i] = (d[i]&bw[k+i]) | rr[k+i];
+		}
+	}
 }
 
+#else
+
+int fb_band(int y)
+{
+	return scr_h-y;
+}
+
+
+int fb_overflow(void)
+{
+	return 0;
+}
+
+#endif
+
 
 /******************************************************************************/
 #if 0
@@ -1,6 +1,11 @@
 
 
 #include "epd.h"
+#include "user_periph_setup.h"
+#include "wkupct_quadec.h"
+#include "lld_evt.h"
+#include "arch_api.h"
+#include "app_easy_msg_utils.h"
 
 
 /******************************************************************************/
@@ -13,6 +18,15 @@ static int epio_cs;
 static int epio_clk;
 static int epio_sdi;
 
+static int epd_bus_on;  // SPI控制器当前是否接管了CLK/SDI
+static int epd_opened;
+static int epd_pwr_val;
+static int epd_rst_val;
+
+static void (*busy_cb)(void);
+
+static u32 tick_start;
+
 
 #define EPD_CLK(n)  gpio_set(epio_clk, (n))
 #define EPD_SDI(n)  gpio_set(epio_sdi, (n))
@@ -68,10 +82,12 @@ void delay_ms(int ms)
 }
 
 
+/******************************************************************************/
+/* DA1458x GPIO/SPI总线                                                       */
 /******************************************************************************/
 
 
-void epd_hw_init(u32 config0, u32 config1, int w, int h, int mode)
+static void hw_config(u32 config0, u32 config1)
 {
 	epio_pwr  = (config0>>24)&0xff;
 	epio_busy = (config0>>16)&0xff;
@@ -80,36 +96,181 @@ void epd_hw_init(u32 config0, u32 config1, int w, int h, int mode)
 	epio_cs   = (config1>>16)&0xff;
 	epio_clk  = (config1>> 8)&0xff;
 	epio_sdi  = (config1>> 0)&0xff;
+}
+
+
+static void epd_spi_on(void)
+{
+	if(epd_bus==&epd_bus_spi && epd_bus_on==0){
+		espi_init(epio_clk, epio_sdi);
+		epd_bus_on = 1;
+	}
+}
+
+
+static void epd_spi_off(void)
+{
+	if(epd_bus_on){
+		espi_exit(epio_clk, epio_sdi);
+		epd_bus_on = 0;
+	}
+}
+
 
-	scr_w = w;
-	scr_h = h;
-	scr_mode = mode;
-	line_bytes = (scr_w+7)>>3;
-	scr_padding = line_bytes*8-scr_w;
+// 屏关闭时的IO状态. 屏保持供电时(深度休眠或唤醒), PWR/RST/CS维持高电平,
+// 否则全部拉低.
+static void hw_idle_pins(void)
+{
+	gpio_config(epio_pwr , 0x0300, epd_pwr_val);
+	gpio_config(epio_busy, 0x0000, 0);
+	gpio_config(epio_rst , 0x0300, epd_pwr_val);
+	gpio_config(epio_dc  , 0x0300, 0);
+	gpio_config(epio_cs  , 0x0300, epd_pwr_val);
+	gpio_config(epio_clk , 0x0300, 0);
+	gpio_config(epio_sdi , 0x0300, 0);
 }
 
-void epd_hw_open(void)
+
+// 屏可能还在供电(深度休眠或保持唤醒), 这时不断电也不复位, 由epd_init决定是否复位.
+static void hw_open(void)
 {
-	gpio_config(epio_pwr , 0x0300, 0);
+	if(epd_pwr_val==0)
+		epd_rst_val = 0;
+
+	gpio_config(epio_pwr , 0x0300, epd_pwr_val);
 	gpio_config(epio_busy, 0x0000, 1);
-	gpio_config(epio_rst , 0x0300, 0);
+	gpio_config(epio_rst , 0x0300, epd_rst_val);
 	gpio_config(epio_dc  , 0x0300, 0);
 	gpio_config(epio_cs  , 0x0300, 1);
 	gpio_config(epio_clk , 0x0300, 0);
 	gpio_config(epio_sdi , 0x0300, 0);
+
+	epd_opened = 1;
+	epd_spi_on();
 }
 
-void epd_hw_close(void)
+
+// 从休眠中唤醒后外设掉电, IO配置丢失. 屏正在刷新时要在打开pad latch之前恢复,
+// 否则屏会断电而花屏; 屏在深度休眠中时也要保持供电. 由set_pad_functions调用.
+void epd_hw_restore(void)
 {
-	gpio_config(epio_pwr , 0x0300, 0);
-	gpio_config(epio_busy, 0x0000, 0);
-	gpio_config(epio_rst , 0x0300, 0);
+	if(epd_opened==0){
+		if(epd_pwr_val)
+			hw_idle_pins();
+		return;
+	}
+
+	gpio_config(epio_pwr , 0x0300, epd_pwr_val);
+	gpio_config(epio_busy, 0x0000, 1);
+	gpio_config(epio_rst , 0x0300, epd_rst_val);
 	gpio_config(epio_dc  , 0x0300, 0);
-	gpio_config(epio_cs  , 0x0300, 0);
+	gpio_config(epio_cs  , 0x0300, 1);
 	gpio_config(epio_clk , 0x0300, 0);
 	gpio_config(epio_sdi , 0x0300, 0);
+
+	epd_bus_on = 0;
+	epd_spi_on();
+}
+
+
+static void hw_close(void)
+{
+	epd_spi_off();
+	epd_opened = 0;
+
+	hw_idle_pins();
+}
+
+
+static void hw_power(int on)
+{
+	epd_pwr_val = on;
+	EPD_PWR(on);
+}
+
+
+static void hw_reset(int val)
+{
+	epd_rst_val = val;
+	EPD_RST(val);
+}
+
+
+static int hw_busy(void)
+{
+	return EPD_BUSY();
+}
+
+
+// BUSY变低时的中断. cb要做SPI传输, 还可能和主循环中的绘制冲突, 不能在中断中执行:
+// 这里只唤醒BLE核, 发一个消息让主循环调用epd_busy_main.
+static void epd_busy_isr(void)
+{
+	wkupct_disable_irq();
+	if(busy_cb==NULL)
+		return;
+
+	if(GetBits16(SYS_STAT_REG, PER_IS_DOWN))
+		periph_init();
+	arch_ble_force_wakeup();
+	app_easy_wakeup();
+}
+
+
+static void hw_notify(void (*cb)(void));
+
+static void epd_busy_main(void)
+{
+	void (*cb)(void) = busy_cb;
+
+	// 取消(或超时)之后才到的消息
+	if(cb==NULL)
+		return;
+	if(EPD_BUSY()){
+		hw_notify(cb);
+		return;
+	}
+	busy_cb = NULL;
+	cb();
+}
+
+
+// 使用唤醒控制器检测BUSY变低, cb在主循环中执行. cb为NULL时取消.
+static void hw_notify(void (*cb)(void))
+{
+	int port = epio_busy>>4;
+	int pin  = epio_busy&0x0f;
+
+	busy_cb = cb;
+	if(cb==NULL){
+		wkupct_disable_irq();
+		return;
+	}
+	app_easy_wakeup_set(epd_busy_main);
+	wkupct_register_callback(epd_busy_isr);
+	wkupct_enable_irq(WKUPCT_PIN_SELECT(port, pin), WKUPCT_PIN_POLARITY(port, pin, WKUPCT_PIN_POLARITY_LOW), 1, 0);
+
+	// 使能中断之前BUSY可能已经变低了
+	if(EPD_BUSY()==0){
+		GLOBAL_INT_DISABLE();
+		epd_busy_isr();
+		GLOBAL_INT_RESTORE();
+	}
+}
+
+
+static void hw_cs(int val)
+{
+	EPD_CS(val);
 }
 
+
+static void hw_dc(int val)
+{
+	EPD_DC(val);
+}
+
+
 static void epd_spi_write(int value)
 {
 	int i;
@@ -138,142 +299,288 @@ static int epd_spi_read(void)
 }
 
 
-void epd_reset(int val)
+static void gpio_write(u8 *data, int len)
 {
-	EPD_RST(val);
+	for(int i=0; i<len; i++){
+		epd_spi_write(data[i]);
+	}
 }
 
 
-void epd_wait(void)
+static void gpio_fill(int data, int len)
 {
-	while(EPD_BUSY());
+	for(int i=0; i<len; i++){
+		epd_spi_write(data);
+	}
 }
 
 
-int epd_busy(void)
+static void spi_write(u8 *data, int len)
 {
-	return EPD_BUSY();
+	if(len==1){
+		espi_write(data[0]);
+	}else{
+		espi_write_array(data, len);
+	}
 }
 
 
-void epd_power(int on)
+// 读操作是三线双向的, 只能用GPIO模拟. 读之前先从SPI控制器收回IO.
+static void hw_read(u8 *data, int len)
 {
-	EPD_PWR(on);
-}
+	int bus_on = epd_bus_on;
+	epd_spi_off();
 
+	EPD_DIN();
+	for(int i=0; i<len; i++){
+		data[i] = epd_spi_read();
+	}
+	EPD_DOUT();
 
-void epd_cmd(int cmd)
-{
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
-	EPD_CS(1);
+	if(bus_on)
+		epd_spi_on();
 }
 
 
-void epd_data(int data)
+// 用SysTick计时(系统时钟, 24位递减计数). 单次传输远小于1秒, 不会溢出.
+#define EPD_TICK_MHZ  16
+
+static void hw_timer_start(void)
 {
-	EPD_CS(0);
-	EPD_DC(1);
-	epd_spi_write(data);
-	EPD_CS(1);
+	SysTick->LOAD = 0x00ffffff;
+	SysTick->VAL  = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+	tick_start = SysTick->VAL;
 }
 
 
-void epd_cmd1(int cmd, int d0)
+static u32 hw_timer_us(void)
 {
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
-	EPD_DC(1);
-	epd_spi_write(d0);
-	EPD_CS(0);
+	u32 ticks = (tick_start - SysTick->VAL) & 0x00ffffff;
+	SysTick->CTRL = 0;
+	return ticks/EPD_TICK_MHZ;
 }
 
 
-void epd_cmd2(int cmd, int d0, int d1)
+// BLE的基准时钟(625us, 27位)在休眠时由低功耗时钟补偿, 唤醒后仍然连续.
+// 这里把它扩展成32位.
+static u32 clock_last;
+static u32 clock_slots;
+
+static u32 hw_clock(void)
 {
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
-	EPD_DC(1);
-	epd_spi_write(d0);
-	epd_spi_write(d1);
-	EPD_CS(0);
+	u32 now = lld_evt_time_get();
+
+	clock_slots += (now-clock_last) & MAX_SLOT_CLOCK;
+	clock_last = now;
+	return clock_slots;
 }
 
 
-void epd_cmd3(int cmd, int d0, int d1, int d2)
+// 读SPI Flash(字库). Flash与屏共用SPI控制器与CLK/DO, 6个测试点的板子上Flash的DI
+// 还是屏的DC. 先收回屏的SPI并拉高屏的CS, 读完后把DC恢复为输出. 关中断, 避免
+// 刷新完成的中断(epd_done)在中途使用总线.
+static void hw_flash_read(int addr, int len, u8 *buf)
 {
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
-	EPD_DC(1);
-	epd_spi_write(d0);
-	epd_spi_write(d1);
-	epd_spi_write(d2);
-	EPD_CS(0);
+	int bus_on;
+
+	GLOBAL_INT_DISABLE();
+	bus_on = epd_bus_on;
+	epd_spi_off();
+	if(epd_opened)
+		EPD_CS(1);
+
+	fspi_init();
+	sf_read(addr, len, buf);
+	fspi_exit();
+
+	gpio_config(epio_dc, 0x0300, 0);
+	if(bus_on)
+		epd_spi_on();
+	GLOBAL_INT_RESTORE();
 }
 
 
-void epd_cmd4(int cmd, int d0, int d1, int d2, int d3)
+EPD_BUS epd_bus_gpio = {
+	.name   = "gpio",
+	.config = hw_config,
+	.open   = hw_open,
+	.close  = hw_close,
+	.power  = hw_power,
+	.reset  = hw_reset,
+	.busy   = hw_busy,
+	.notify = hw_notify,
+	.cs     = hw_cs,
+	.dc     = hw_dc,
+	.write  = gpio_write,
+	.fill   = gpio_fill,
+	.read   = hw_read,
+	.timer_start = hw_timer_start,
+	.timer_us    = hw_timer_us,
+	.clock       = hw_clock,
+	.flash_read  = hw_flash_read,
+};
+
+
+EPD_BUS epd_bus_spi = {
+	.name   = "spi",
+	.config = hw_config,
+	.open   = hw_open,
+	.close  = hw_close,
+	.power  = hw_power,
+	.reset  = hw_reset,
+	.busy   = hw_busy,
+	.notify = hw_notify,
+	.cs     = hw_cs,
+	.dc     = hw_dc,
+	.write  = spi_write,
+	.fill   = espi_fill,
+	.read   = hw_read,
+	.timer_start = hw_timer_start,
+	.timer_us    = hw_timer_us,
+	.clock       = hw_clock,
+	.flash_read  = hw_flash_read,
+};
+
+
+/******************************************************************************/
+/* 屏的配置: Flash中的出厂信息, 保存在保留内存中                              */
+/******************************************************************************/
+
+// 原厂固件在Flash中留下的屏信息, 格式见Readme.
+#define PANEL_IO_ADDR   0x39000
+#define PANEL_RES_ADDR  0x3a000
+
+// 0x39000处第一个字节是屏的类别, 原厂的编号还没有整理完, 不用它判断三色屏.
+// 三色屏按分辨率与控制器判断(见Readme):
+//   296x128                  HINK-E029A10, 三色
+//   250x122 IL3897(LUT 70)   HINK-E0213A67, 三色
+//   250x122 IL3895(LUT 30)   OPM021B1, 黑白
+//   212x104                  黑白
+static int panel_flash_bwr(int w, int h)
 {
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
-	EPD_DC(1);
-	epd_spi_write(d0);
-	epd_spi_write(d1);
-	epd_spi_write(d2);
-	epd_spi_write(d3);
-	EPD_CS(0);
+	if(w==128 && h==296)
+		return EPD_BWR;
+	if(w==122 && h==250 && lut_size==70)
+		return EPD_BWR;
+	return 0;
 }
 
 
-void epd_data_array(u8 *data, int len)
+// 识别出的屏参数. 放在复位时不清零的保留内存中, 热启动时不用再读Flash和探测.
+typedef struct {
+	u32 magic;
+	u32 config0;
+	u32 config1;
+	u16 w;
+	u16 h;
+	u8  mode;
+	u8  lut_size;
+	u16 check;
+}EPD_PANEL;
+
+#define PANEL_MAGIC  0x4c4e4150  // "PANL"
+
+static EPD_PANEL epd_panel __SECTION_ZERO("retention_mem_area_uninit");
+
+
+static u16 panel_check(EPD_PANEL *p)
 {
-	EPD_CS(0);
-	EPD_DC(1);
-	for(int i=0; i<len; i++){
-		epd_spi_write(data[i]);
+	u8 *d = (u8*)p;
+	u16 sum = 0x5a5a;
+
+	while(d<(u8*)&p->check){
+		sum = ((sum<<1) | (sum>>15)) + *d++;
 	}
-	EPD_CS(1);
+	return sum;
 }
 
 
-void epd_read(u8 *data, int len)
+// DA14585的IO: P0_0-7, P1_0-5, P2_0-9, P3_0-7
+static int panel_io_ok(int io)
 {
-	EPD_DIN();
+	static const u8 io_max[4] = {7, 5, 9, 7};
+	int port = io>>4;
 
-	EPD_CS(0);
-	EPD_DC(1);
+	return port<4 && (io&0x0f)<=io_max[port];
+}
 
-	for(int i=0; i<len; i++){
-		data[i] = epd_spi_read();
-	}
-	EPD_CS(1);
 
-	EPD_DOUT();
+// 热启动时从保留内存恢复屏的配置. 成功返回1, 之后不用再调用epd_detect.
+int epd_panel_load(void)
+{
+	EPD_PANEL *p = &epd_panel;
+
+	if(p->magic!=PANEL_MAGIC || p->check!=panel_check(p))
+		return 0;
+
+	epd_hw_init(p->config0, p->config1, p->w, p->h, p->mode);
+	epd_lut_select(p->lut_size);
+	printk("EPD panel: %dx%d mode %02x (retained)\n", p->w, p->h, p->mode);
+	return 1;
 }
 
 
-void epd_cmd_read(int cmd, u8 *data, int len)
+// 保存当前的配置(epd_detect成功之后调用).
+void epd_panel_save(void)
 {
-	EPD_CS(0);
-	EPD_DC(0);
-	epd_spi_write(cmd);
+	EPD_PANEL *p = &epd_panel;
+
+	p->magic = PANEL_MAGIC;
+	p->config0 = (epio_pwr<<24) | (epio_busy<<16) | (epio_rst<<8);
+	p->config1 = (epio_dc<<24) | (epio_cs<<16) | (epio_clk<<8) | epio_sdi;
+	p->w = scr_w;
+	p->h = scr_h;
+	p->mode = scr_mode;
+	p->lut_size = lut_size;
+	p->check = panel_check(p);
+}
 
-	EPD_DC(1);
-	EPD_DIN();
 
-	for(int i=0; i<len; i++){
-		data[i] = epd_spi_read();
+// 按Flash中的出厂信息配置IO与分辨率, 并探测控制器, 由此确定是否是三色屏.
+// 没有有效信息或探测不到屏时返回0.
+int epd_panel_flash(void)
+{
+	u32 io32[4], res32[4];
+	u8 *io = (u8*)io32;
+	u8 *res = (u8*)res32;
+	int i, mode;
+
+	fspi_init();
+	sf_read(PANEL_IO_ADDR, 16, io);
+	sf_read(PANEL_RES_ADDR, 16, res);
+	fspi_exit();
+
+	// io[1]==0x01表示后面有IO配置.
+	// io[8..15]: CS ?? RST CLK SDI DC BUSY PWR
+	if(io[1]!=0x01)
+		return 0;
+	for(i=8; i<16; i++){
+		if(i!=9 && panel_io_ok(io[i])==0)
+			return 0;
 	}
 
-	EPD_DOUT();
-	EPD_CS(1);
+	// res[10..13]: 宽, 高(短边为宽)
+	int w = res[10] | (res[11]<<8);
+	int h = res[12] | (res[13]<<8);
+	if(w==0 || w>128 || h==0 || h>296)
+		return 0;
 
+	u32 config0 = (io[15]<<24) | (io[14]<<16) | (io[10]<<8);
+	u32 config1 = (io[13]<<24) | (io[ 8]<<16) | (io[11]<<8) | io[12];
+
+	epd_hw_init(config0, config1, w, h, ROTATE_3);
+	if(epd_detect()==0)
+		return 0;
+
+	mode = ROTATE_3 | panel_flash_bwr(w, h);
+	if(mode!=ROTATE_3)
+		epd_hw_init(config0, config1, w, h, mode);
+	printk("EPD panel: type %02x %dx%d mode %02x  %08x %08x\n", io[0], w, h, mode, config0, config1);
+	return 1;
 }
 
+
+
 /******************************************************************************/
 
@@ -0,0 +1,107 @@
+
+
+#include "epd.h"
+
+
+/******************************************************************************/
+
+// 刷新策略: fly刷新会在屏上留下残影, 残影的多少与刷新次数和温度有关.
+// 这里按区域累计fly刷新的次数(即"残影预算"), 某个区域用完预算时才做一次fast,
+// fast做够次数或者太久没有全刷时才做一次full.
+
+// 屏按原生坐标的行(Gate)分成几个区域. 分钟数字附近的区域刷得最多.
+#define POLICY_REGIONS  8
+
+EPD_POLICY epd_policy = {
+	.fly_budget    = 16,
+	.fast_budget   = 6,
+	.full_interval = 6*60,
+	.cold_temp     = 10,
+	.hot_temp      = 35,
+};
+
+static u16 region_cost[POLICY_REGIONS];
+static u16 fast_count;
+static u16 full_age;   // 上次full之后的分钟数
+static u16 sec_acc;
+
+
+// 由时钟定时器调用, secs是经过的秒数.
+void epd_policy_tick(int secs)
+{
+	sec_acc += secs;
+	while(sec_acc>=60){
+		sec_acc -= 60;
+		if(full_age<0xffff)
+			full_age += 1;
+	}
+}
+
+
+// 根据请求的模式与已用的预算决定实际的刷新模式. 请求的模式是下限.
+int epd_policy_mode(int want)
+{
+	EPD_POLICY *p = &epd_policy;
+	int i;
+
+	if(want==UPDATE_FULL)
+		return UPDATE_FULL;
+
+	if(full_age>=p->full_interval || fast_count>=p->fast_budget)
+		return UPDATE_FULL;
+
+	if(want==UPDATE_FAST)
+		return UPDATE_FAST;
+
+	for(i=0; i<POLICY_REGIONS; i++){
+		if(region_cost[i]>=p->fly_budget*2)
+			return UPDATE_FAST;
+	}
+
+	return UPDATE_FLY;
+}
+
+
+// 刷新之后记账. r是发送给屏的区域(原生坐标), 空表示整屏.
+void epd_policy_done(RECT *r, int mode)
+{
+	EPD_POLICY *p = &epd_policy;
+	int i, y1, y2, cost;
+
+	if(mode==UPDATE_FULL){
+		memset(region_cost, 0, sizeof(region_cost));
+		fast_count = 0;
+		full_age = 0;
+		return;
+	}
+
+	if(mode==UPDATE_FAST){
+		// fast驱动了所有像素, 区域的残影都清掉了
+		memset(region_cost, 0, sizeof(region_cost));
+		fast_count += 1;
+		return;
+	}
+
+	// 一次fly记2, 温度低时粒子移动慢, 残影多; 温度高时容易过驱. 这时记3.
+	cost = 2;
+	if(epd_temp<p->cold_temp || epd_temp>p->hot_temp)
+		cost = 3;
+
+	if(r==NULL || rect_empty(r)){
+		y1 = 0;
+		y2 = scr_h-1;
+	}else{
+		y1 = r->y1;
+		y2 = r->y2;
+	}
+	y1 = y1*POLICY_REGIONS/scr_h;
+	y2 = y2*POLICY_REGIONS/scr_h;
+	for(i=y1; i<=y2; i++){
+		if(region_cost[i]<p->fly_budget*2)
+			region_cost[i] += cost;
+	}
+}
+
+
+/******************************************************************************/
+
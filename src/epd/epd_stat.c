@@ -0,0 +1,145 @@
+
+
+#include "epd.h"
+
+
+/******************************************************************************/
+
+// 刷新时间统计: 从发出0x20到BUSY变低的时间, 按刷新模式与控制器温度分组做直方图.
+// 放在复位时不清零的保留内存中, 通过蓝牙读出(epd_stat_read).
+//
+// 读出的格式(小端):
+//   [0]  版本(1)
+//   [1]  控制器的LUT长度(即驱动类型)
+//   [2]  scr_mode, 其中0x20表示三色屏
+//   [3]  温度分组数 STAT_TEMPS
+//   [4]  时间分组数 STAT_BINS
+//   [5]  保留
+//   [6]  u16 max_ms[3]            每种模式最长的一次
+//   [12] u16 hist[3][STAT_TEMPS][STAT_BINS]
+//
+// 温度分组: <0 0-9 10-19 20-29 >=30
+// 时间分组(ms): <250 <500 <1000 <1500 <2000 <3000 <5000 >=5000
+
+#define STAT_VERSION  1
+#define STAT_MODES    3
+#define STAT_TEMPS    5
+#define STAT_BINS     8
+
+static const u16 stat_bin_ms[STAT_BINS-1] = {250, 500, 1000, 1500, 2000, 3000, 5000};
+
+typedef struct {
+	u32 magic;
+	u8  lut_size;
+	u8  mode;
+	u16 max_ms[STAT_MODES];
+	u16 hist[STAT_MODES][STAT_TEMPS][STAT_BINS];
+}EPD_STAT;
+
+#define STAT_MAGIC  0x54415453  // "STAT"
+
+static EPD_STAT epd_stat __SECTION_ZERO("retention_mem_area_uninit");
+
+// 正在进行的刷新
+static int stat_busy;
+static int stat_mode;
+static int stat_temp;
+static u32 stat_start;
+
+
+void epd_stat_clear(void)
+{
+	memset(&epd_stat, 0, sizeof(epd_stat));
+	epd_stat.magic = STAT_MAGIC;
+	epd_stat.lut_size = lut_size;
+	epd_stat.mode = scr_mode;
+}
+
+
+// 由epd_update在发出0x20之后调用. mode是实际使用的刷新模式.
+void epd_stat_start(int mode)
+{
+	// 换了屏(或者第一次上电)时重新统计
+	if(epd_stat.magic!=STAT_MAGIC || epd_stat.lut_size!=lut_size || epd_stat.mode!=scr_mode)
+		epd_stat_clear();
+
+	stat_mode = mode;
+	stat_temp = epd_temp;
+	stat_start = epd_bus->clock();
+	stat_busy = 1;
+}
+
+
+// BUSY变低时调用. 没有进行中的刷新时什么也不做.
+void epd_stat_done(void)
+{
+	int ms, t, b;
+	u16 *cnt;
+
+	if(stat_busy==0)
+		return;
+	stat_busy = 0;
+
+	ms = (epd_bus->clock()-stat_start)*5/8;
+
+	t = stat_temp;
+	t = (t<0)? 0 : (t>=30)? STAT_TEMPS-1 : t/10+1;
+
+	for(b=0; b<STAT_BINS-1; b++){
+		if(ms<stat_bin_ms[b])
+			break;
+	}
+
+	cnt = &epd_stat.hist[stat_mode][t][b];
+	if(*cnt<0xffff)
+		*cnt += 1;
+
+	if(ms>0xffff)
+		ms = 0xffff;
+	if(ms>epd_stat.max_ms[stat_mode])
+		epd_stat.max_ms[stat_mode] = ms;
+}
+
+
+static u8 *put_u16(u8 *p, int val)
+{
+	p[0] = val;
+	p[1] = val>>8;
+	return p+2;
+}
+
+
+// 按上面的格式输出统计结果, 返回长度.
+int epd_stat_read(u8 *buf, int len)
+{
+	u8 tmp[12+STAT_MODES*STAT_TEMPS*STAT_BINS*2];
+	u8 *p = tmp;
+	int m, t, b;
+
+	if(epd_stat.magic!=STAT_MAGIC)
+		epd_stat_clear();
+
+	*p++ = STAT_VERSION;
+	*p++ = epd_stat.lut_size;
+	*p++ = epd_stat.mode;
+	*p++ = STAT_TEMPS;
+	*p++ = STAT_BINS;
+	*p++ = 0;
+	for(m=0; m<STAT_MODES; m++)
+		p = put_u16(p, epd_stat.max_ms[m]);
+	for(m=0; m<STAT_MODES; m++){
+		for(t=0; t<STAT_TEMPS; t++){
+			for(b=0; b<STAT_BINS; b++)
+				p = put_u16(p, epd_stat.hist[m][t][b]);
+		}
+	}
+
+	if(len>p-tmp)
+		len = p-tmp;
+	memcpy(buf, tmp, len);
+	return len;
+}
+
+
+/******************************************************************************/
+
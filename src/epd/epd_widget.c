@@ -0,0 +1,135 @@
+
+
+#include "epd.h"
+
+
+/******************************************************************************/
+
+// 保留模式的部件: 屏幕分为几个部件, key描述部件的内容, key没变的部件不重画.
+//
+// 整屏FB时上一帧的像素都还在, 只擦掉重画key变了的部件(以及与之重叠的部件).
+// 分条绘制时每一帧都要整屏重画, 这时给出了范围(w不为0)的部件把画好的像素缓存
+// 起来, key没变时直接合成缓存, 不再排版与解码文字. 部件画出的内容必须在范围之内.
+
+#define WG_VALID    0x01  // key与rect有效
+#define WG_CACHED   0x02  // bits中是key对应的像素
+#define WG_NOCACHE  0x04  // 已经分配过缓存(bits为NULL表示没有空间)
+
+// 整屏FB时一次最多处理的部件个数
+#define WG_MAX      32
+
+
+#if EPD_STRIP_LINES
+
+static void widget_draw(EPD_WIDGET *wg, int id, void (*draw)(int id, int flags), int flags)
+{
+	int mark;
+
+	if(wg->w && (wg->state&WG_NOCACHE)==0){
+		wg->bits = fb_cache_alloc(wg->x, wg->y, wg->w, wg->h, &wg->rect);
+		wg->state |= WG_NOCACHE;
+	}
+	if(wg->bits==NULL){
+		draw(id, flags);
+		return;
+	}
+
+	mark = fb_cache_begin();
+	draw(id, flags);
+	fb_cache_end(mark, &wg->rect, wg->bits);
+	wg->state |= WG_CACHED;
+}
+
+
+void epd_widget_update(EPD_WIDGET *wg, int num, const int *key, void (*draw)(int id, int flags), int flags, int all)
+{
+	int i;
+
+	// 没有保留上一帧, 整屏重画(改动的行由epd_screen_diff找出). 缓存与屏上的内容
+	// 无关, all时也可以用.
+	fb_clear();
+	for(i=0; i<num; i++){
+		if((wg[i].state&WG_CACHED) && wg[i].key==key[i]){
+			fb_cache_put(&wg[i].rect, wg[i].bits);
+		}else{
+			widget_draw(&wg[i], i, draw, flags);
+			wg[i].key = key[i];
+			wg[i].state |= WG_VALID;
+		}
+	}
+
+	// 显示列表放不下时缓存的内容可能不完整, 下次全部重画
+	if(fb_overflow()){
+		for(i=0; i<num; i++)
+			wg[i].state &= ~(WG_VALID|WG_CACHED);
+	}
+}
+
+#else
+
+// 只重画内容变化了的部件, 改动的范围记录在fb_dirty中.
+void epd_widget_update(EPD_WIDGET *wg, int num, const int *key, void (*draw)(int id, int flags), int flags, int all)
+{
+	u8 redraw[WG_MAX];
+	int i, j, more;
+
+	if(num>WG_MAX){
+		printk("widget: %d > %d, rest dropped\n", num, WG_MAX);
+		num = WG_MAX;
+	}
+
+	for(i=0; i<num; i++){
+		if((wg[i].state&WG_VALID)==0)
+			all = 1;
+	}
+
+	if(all){
+		fb_clear();
+		for(i=0; i<num; i++){
+			redraw[i] = 1;
+			rect_clear(&wg[i].rect);
+		}
+	}else{
+		for(i=0; i<num; i++){
+			redraw[i] = (key[i]!=wg[i].key);
+		}
+		// 擦除的范围与别的部件重叠时, 那个部件也要重画.
+		do{
+			more = 0;
+			for(i=0; i<num; i++){
+				if(redraw[i]==0)
+					continue;
+				for(j=0; j<num; j++){
+					if(redraw[j]==0 && rect_overlap(&wg[i].rect, &wg[j].rect)){
+						redraw[j] = 1;
+						more = 1;
+					}
+				}
+			}
+		}while(more);
+
+		for(i=0; i<num; i++){
+			if(redraw[i])
+				fb_clear_rect(&wg[i].rect);
+		}
+	}
+
+	for(i=0; i<num; i++){
+		if(redraw[i]==0)
+			continue;
+
+		RECT dirty = fb_dirty;
+		rect_clear(&fb_dirty);
+		draw(i, flags);
+		wg[i].key = key[i];
+		wg[i].rect = fb_dirty;
+		wg[i].state |= WG_VALID;
+		rect_union(&fb_dirty, &dirty);
+	}
+}
+
+#endif
+
+
+/******************************************************************************/
+
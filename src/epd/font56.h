@@ -1,169 +1,64 @@
 #ifndef __F_DSEG7_56__
 #define __F_DSEG7_56__
 
-#define F_DSEG7_56_size  2567
-static unsigned char F_DSEG7_56[] __attribute__((aligned(4))) = {
-	0x0b, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x46, 0x01, 0x32, 0x00, 0x7e, 0x01, 0x33, 0x00,
-	0x96, 0x02, 0x34, 0x00, 0x77, 0x03, 0x35, 0x00, 0x7b, 0x04, 0x36, 0x00, 0x93, 0x05, 0x37, 0x00,
-	0xab, 0x06, 0x38, 0x00, 0xb4, 0x07, 0x39, 0x00, 0xcc, 0x08, 0x3a, 0x00, 0xe4, 0x09, 0x2c, 0x22,
-	0x37, 0x05, 0x01, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff,
-	0xfe, 0x00, 0x6f, 0xff, 0xff, 0xfd, 0x80, 0xf7, 0xff, 0xff, 0xfb, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0,
-	0xe0, 0x00, 0x00, 0x01, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-	0x00, 0x00, 0x00, 0xc0, 0xe0, 0x00, 0x00, 0x01, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf7, 0xff, 0xff,
-	0xfb, 0xc0, 0x6f, 0xff, 0xff, 0xfd, 0x80, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe,
-	0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x2c, 0x05, 0x33, 0x22, 0x02, 0x10, 0x38, 0x78, 0xf8, 0xf8,
-	0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-	0xf8, 0x78, 0x38, 0x18, 0x00, 0x18, 0x38, 0x78, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-	0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x78, 0x38, 0x10, 0x2c, 0x22,
-	0x37, 0x05, 0x01, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff,
-	0xfe, 0x00, 0x0f, 0xff, 0xff, 0xfd, 0x80, 0x07, 0xff, 0xff, 0xfb, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
-	0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
-	0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0,
-	0x0f, 0xff, 0xff, 0xfd, 0xc0, 0x1f, 0xff, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xdf,
-	0xff, 0xff, 0xfe, 0x00, 0xef, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
-	0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8,
-	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff,
-	0xf8, 0x00, 0x6f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe,
-	0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x2c, 0x20, 0x37, 0x07, 0x01, 0x7f, 0xff, 0xff, 0xf8, 0xff,
-	0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xef, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x3f,
-	0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfb, 0x3f,
-	0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
-	0x00, 0x00, 0x1f, 0x1f, 0xff, 0xff, 0xef, 0x3f, 0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0xf8, 0x7f,
-	0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf0, 0x2c, 0x22, 0x33, 0x05, 0x02, 0x40, 0x00, 0x00, 0x00,
-	0x80, 0xe0, 0x00, 0x00, 0x01, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xef,
-	0xff, 0xff, 0xfd, 0xc0, 0xdf, 0xff, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff,
-	0xff, 0xfe, 0xc0, 0x0f, 0xff, 0xff, 0xfd, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
-	0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
-	0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x03,
-	0xc0, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2c, 0x22, 0x37, 0x05, 0x01,
-	0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x6f,
-	0xff, 0xff, 0xfc, 0x00, 0xf7, 0xff, 0xff, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
-	0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8,
-	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff,
-	0xfc, 0x00, 0xdf, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe,
-	0xc0, 0x0f, 0xff, 0xff, 0xfd, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
-	0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
-	0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x07, 0xff, 0xff, 0xfb, 0xc0, 0x0f,
-	0xff, 0xff, 0xfd, 0x80, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff,
-	0xff, 0xfc, 0x00, 0x2c, 0x22, 0x37, 0x05, 0x01, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff,
-	0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x6f, 0xff, 0xff, 0xfc, 0x00, 0xf7, 0xff, 0xff, 0xf8,
-	0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8,
-	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
-	0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xfc, 0x00, 0xdf, 0xff, 0xff, 0xfc, 0x00, 0x3f,
-	0xff, 0xff, 0xfe, 0x00, 0xdf, 0xff, 0xff, 0xfe, 0xc0, 0xef, 0xff, 0xff, 0xfd, 0xc0, 0xf0, 0x00,
-	0x00, 0x03, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf7, 0xff, 0xff, 0xfb, 0xc0, 0x6f, 0xff, 0xff, 0xfd, 0x80, 0x1f, 0xff, 0xff, 0xfe,
-	0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x2c, 0x22, 0x34, 0x05, 0x03,
-	0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x6f,
-	0xff, 0xff, 0xfd, 0x80, 0xf7, 0xff, 0xff, 0xfb, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xe0, 0x00, 0x00,
-	0x01, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
-	0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
-	0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00,
-	0x00, 0x00, 0x01, 0x80, 0x2c, 0x22, 0x37, 0x05, 0x01, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff,
-	0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x6f, 0xff, 0xff, 0xfd, 0x80, 0xf7, 0xff, 0xff,
-	0xfb, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xef, 0xff, 0xff, 0xfd, 0xc0, 0xdf, 0xff, 0xff, 0xfc, 0xc0,
-	0x3f, 0xff, 0xff, 0xfe, 0x00, 0xdf, 0xff, 0xff, 0xfe, 0xc0, 0xef, 0xff, 0xff, 0xfd, 0xc0, 0xf0,
-	0x00, 0x00, 0x03, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf7, 0xff, 0xff, 0xfb, 0xc0, 0x6f, 0xff, 0xff, 0xfd, 0x80, 0x1f, 0xff, 0xff,
-	0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x2c, 0x22, 0x37, 0x05,
-	0x01, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00,
-	0x6f, 0xff, 0xff, 0xfd, 0x80, 0xf7, 0xff, 0xff, 0xfb, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00,
-	0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00,
-	0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07,
-	0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0,
-	0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf8,
-	0x00, 0x00, 0x07, 0xc0, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0xef, 0xff,
-	0xff, 0xfd, 0xc0, 0xdf, 0xff, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff,
-	0xfe, 0xc0, 0x0f, 0xff, 0xff, 0xfd, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0,
-	0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
-	0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
-	0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-	0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07,
-	0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x07, 0xff, 0xff, 0xfb, 0xc0,
-	0x0f, 0xff, 0xff, 0xfd, 0x80, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x0f,
-	0xff, 0xff, 0xfc, 0x00, 0x0b, 0x07, 0x1e, 0x02, 0x0c, 0x38, 0x7c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x7c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38,
+#define F_DSEG7_56_size  881
+static const unsigned char F_DSEG7_56[] __attribute__((aligned(4))) = {
+	0x0b, 0xf0, 0x30, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x85, 0x00, 0x32, 0x00, 0xae, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x34, 0x00, 0x4d, 0x01, 0x35, 0x00, 0xa4, 0x01, 0x36, 0x00, 0xfb, 0x01, 0x37, 0x00,
+	0x52, 0x02, 0x38, 0x00, 0xa9, 0x02, 0x39, 0x00, 0x00, 0x03, 0x3a, 0x00, 0x57, 0x03, 0x2c, 0x22,
+	0x37, 0x05, 0x01, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0, 0x1f,
+	0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff,
+	0x83, 0xff, 0xff, 0xec, 0xf7, 0xff, 0xff, 0x01, 0xff, 0xff, 0xde, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3e, 0xf7, 0xff, 0xff, 0x01, 0xff, 0xff, 0xde, 0x6f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xec,
+	0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x0f, 0xff,
+	0xff, 0xef, 0xff, 0xff, 0xe0, 0x2c, 0x05, 0x33, 0x22, 0x02, 0x00, 0x7f, 0xff, 0xff, 0xbf, 0xff,
+	0xff, 0xc0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0,
+	0x3f, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xfc, 0x07, 0xff, 0xff, 0x00, 0x2c, 0x22,
+	0x37, 0x05, 0x01, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f,
+	0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff,
+	0x98, 0x00, 0x00, 0x0c, 0xf7, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x1e, 0xf8, 0x00, 0x00, 0x7c, 0x00,
+	0x00, 0x3e, 0xf0, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xde, 0x60, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xec,
+	0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x0f, 0xff, 0xff, 0xe0, 0x2c, 0x20, 0x37, 0x07, 0x01, 0x03, 0xff, 0xff, 0xf8, 0x0f, 0xff,
+	0xff, 0xef, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xec, 0xf7, 0xff, 0xff, 0x7d, 0xff, 0xff,
+	0xde, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0xf0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1e, 0xe0,
+	0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2c, 0x22, 0x33,
+	0x05, 0x02, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0xff, 0xff,
+	0xff, 0xbf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xfe, 0x6f,
+	0xff, 0xff, 0x80, 0x1f, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+	0x00, 0x1f, 0xff, 0xfd, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x7f,
+	0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
+	0x80, 0x00, 0x00, 0x00, 0x2c, 0x22, 0x37, 0x05, 0x01, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x07,
+	0xff, 0xff, 0xf0, 0x60, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xec, 0xf0, 0x00, 0x00, 0x7d, 0xff, 0xff,
+	0xde, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0xf7, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x1e, 0x6f,
+	0xff, 0xff, 0xb8, 0x00, 0x00, 0x0c, 0x1f, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
+	0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x2c, 0x22, 0x37, 0x05, 0x01,
+	0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f,
+	0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x60, 0x00, 0x00, 0x1b, 0xff, 0xff,
+	0xec, 0xf0, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xde, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0xf7,
+	0xff, 0xff, 0x7d, 0xff, 0xff, 0xde, 0x6f, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xec, 0x1f, 0xff, 0xff,
+	0xd7, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xef, 0xff,
+	0xff, 0xe0, 0x2c, 0x22, 0x34, 0x05, 0x03, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xef,
+	0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff,
+	0xf0, 0x6f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xe0, 0xf7, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc0, 0xf8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff,
+	0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00,
+	0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x2c, 0x22, 0x37, 0x05, 0x01, 0x03, 0xff,
+	0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff,
+	0xf0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xec, 0xf7,
+	0xff, 0xff, 0x7d, 0xff, 0xff, 0xde, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0xf7, 0xff, 0xff,
+	0x7d, 0xff, 0xff, 0xde, 0x6f, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xec, 0x1f, 0xff, 0xff, 0xd7, 0xff,
+	0xff, 0xf0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0,
+	0x2c, 0x22, 0x37, 0x05, 0x01, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xef, 0xff, 0xff,
+	0xe0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x6f,
+	0xff, 0xff, 0x9b, 0xff, 0xff, 0xec, 0xf7, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xde, 0xf8, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x3e, 0xf7, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x1e, 0x6f, 0xff, 0xff, 0xb8, 0x00,
+	0x00, 0x0c, 0x1f, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
+	0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0b, 0x07, 0x1e, 0x02, 0x0c, 0x18, 0x38, 0x00, 0x00,
+	0x70, 0x7c, 0x00, 0x00, 0xf8, 0xfe, 0x00, 0x01, 0xfc, 0x7c, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00,
+	0x70,
 };
 
 #endif
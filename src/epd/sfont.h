@@ -1,314 +1,297 @@
 #ifndef __sfont__
 #define __sfont__
 
-#define sfont_size  4893
-static unsigned char sfont[] __attribute__((aligned(4))) = {
-	0xbc, 0x00, 0x20, 0x00, 0xf2, 0x02, 0x21, 0x00, 0xf8, 0x02, 0x22, 0x00, 0x08, 0x03, 0x23, 0x00,
-	0x10, 0x03, 0x24, 0x00, 0x20, 0x03, 0x25, 0x00, 0x30, 0x03, 0x26, 0x00, 0x3e, 0x03, 0x27, 0x00,
-	0x4c, 0x03, 0x28, 0x00, 0x54, 0x03, 0x29, 0x00, 0x65, 0x03, 0x2a, 0x00, 0x76, 0x03, 0x2b, 0x00,
-	0x82, 0x03, 0x2c, 0x00, 0x8e, 0x03, 0x2d, 0x00, 0x97, 0x03, 0x2e, 0x00, 0x9d, 0x03, 0x2f, 0x00,
-	0xa4, 0x03, 0x30, 0x00, 0xb5, 0x03, 0x31, 0x00, 0xc3, 0x03, 0x32, 0x00, 0xd1, 0x03, 0x33, 0x00,
-	0xdf, 0x03, 0x34, 0x00, 0xed, 0x03, 0x35, 0x00, 0xfb, 0x03, 0x36, 0x00, 0x09, 0x04, 0x37, 0x00,
-	0x17, 0x04, 0x38, 0x00, 0x25, 0x04, 0x39, 0x00, 0x33, 0x04, 0x3a, 0x00, 0x41, 0x04, 0x3b, 0x00,
-	0x4d, 0x04, 0x3c, 0x00, 0x5b, 0x04, 0x3d, 0x00, 0x6b, 0x04, 0x3e, 0x00, 0x74, 0x04, 0x3f, 0x00,
-	0x84, 0x04, 0x40, 0x00, 0x93, 0x04, 0x41, 0x00, 0xac, 0x04, 0x42, 0x00, 0xba, 0x04, 0x43, 0x00,
-	0xc8, 0x04, 0x44, 0x00, 0xd6, 0x04, 0x45, 0x00, 0xe4, 0x04, 0x46, 0x00, 0xf2, 0x04, 0x47, 0x00,
-	0x00, 0x05, 0x48, 0x00, 0x0e, 0x05, 0x49, 0x00, 0x1c, 0x05, 0x4a, 0x00, 0x2a, 0x05, 0x4b, 0x00,
-	0x3b, 0x05, 0x4c, 0x00, 0x49, 0x05, 0x4d, 0x00, 0x57, 0x05, 0x4e, 0x00, 0x65, 0x05, 0x4f, 0x00,
-	0x73, 0x05, 0x50, 0x00, 0x81, 0x05, 0x51, 0x00, 0x8f, 0x05, 0x52, 0x00, 0x9e, 0x05, 0x53, 0x00,
-	0xac, 0x05, 0x54, 0x00, 0xba, 0x05, 0x55, 0x00, 0xc8, 0x05, 0x56, 0x00, 0xd6, 0x05, 0x57, 0x00,
-	0xe4, 0x05, 0x58, 0x00, 0xfb, 0x05, 0x59, 0x00, 0x09, 0x06, 0x5a, 0x00, 0x17, 0x06, 0x5b, 0x00,
-	0x25, 0x06, 0x5c, 0x00, 0x36, 0x06, 0x5d, 0x00, 0x45, 0x06, 0x5e, 0x00, 0x56, 0x06, 0x5f, 0x00,
-	0x5e, 0x06, 0x60, 0x00, 0x64, 0x06, 0x61, 0x00, 0x6c, 0x06, 0x62, 0x00, 0x78, 0x06, 0x63, 0x00,
-	0x87, 0x06, 0x64, 0x00, 0x93, 0x06, 0x65, 0x00, 0xa2, 0x06, 0x66, 0x00, 0xae, 0x06, 0x67, 0x00,
-	0xbd, 0x06, 0x68, 0x00, 0xcc, 0x06, 0x69, 0x00, 0xdb, 0x06, 0x6a, 0x00, 0xe9, 0x06, 0x6b, 0x00,
-	0xfa, 0x06, 0x6c, 0x00, 0x09, 0x07, 0x6d, 0x00, 0x18, 0x07, 0x6e, 0x00, 0x2b, 0x07, 0x6f, 0x00,
-	0x37, 0x07, 0x70, 0x00, 0x43, 0x07, 0x71, 0x00, 0x52, 0x07, 0x72, 0x00, 0x61, 0x07, 0x73, 0x00,
-	0x6d, 0x07, 0x74, 0x00, 0x79, 0x07, 0x75, 0x00, 0x87, 0x07, 0x76, 0x00, 0x93, 0x07, 0x77, 0x00,
-	0x9f, 0x07, 0x78, 0x00, 0xb2, 0x07, 0x79, 0x00, 0xbe, 0x07, 0x7a, 0x00, 0xcd, 0x07, 0x7b, 0x00,
-	0xd9, 0x07, 0x7c, 0x00, 0xeb, 0x07, 0x7d, 0x00, 0xfc, 0x07, 0x7e, 0x00, 0x0e, 0x08, 0x00, 0x4e,
-	0x16, 0x08, 0x03, 0x4e, 0x1d, 0x08, 0x07, 0x4e, 0x3c, 0x08, 0x09, 0x4e, 0x59, 0x08, 0x2d, 0x4e,
-	0x76, 0x08, 0x5d, 0x4e, 0x97, 0x08, 0x8c, 0x4e, 0xb6, 0x08, 0x94, 0x4e, 0xcd, 0x08, 0xb2, 0x4e,
-	0xea, 0x08, 0xba, 0x4e, 0x09, 0x09, 0x3f, 0x51, 0x28, 0x09, 0x43, 0x51, 0x47, 0x09, 0x49, 0x51,
-	0x64, 0x09, 0x6b, 0x51, 0x83, 0x09, 0x6d, 0x51, 0xa2, 0x09, 0xac, 0x51, 0xc1, 0x09, 0x06, 0x52,
-	0xe0, 0x09, 0x1d, 0x52, 0xff, 0x09, 0xa8, 0x52, 0x1e, 0x0a, 0xb3, 0x52, 0x3d, 0x0a, 0x41, 0x53,
-	0x5c, 0x0a, 0x48, 0x53, 0x7b, 0x0a, 0x58, 0x54, 0x9a, 0x0a, 0xdb, 0x56, 0xb9, 0x0a, 0xfd, 0x56,
-	0xd6, 0x0a, 0x23, 0x57, 0xf5, 0x0a, 0x04, 0x59, 0x14, 0x0b, 0x0f, 0x59, 0x33, 0x0b, 0x15, 0x59,
-	0x50, 0x0b, 0x1c, 0x59, 0x6f, 0x0b, 0x27, 0x59, 0x8e, 0x0b, 0x34, 0x59, 0xad, 0x0b, 0x73, 0x59,
-	0xcc, 0x0b, 0x87, 0x59, 0xeb, 0x0b, 0x89, 0x5b, 0x0a, 0x0c, 0xb5, 0x5b, 0x29, 0x0c, 0xd2, 0x5b,
-	0x48, 0x0c, 0x0f, 0x5c, 0x67, 0x0c, 0x08, 0x5e, 0x86, 0x0c, 0x73, 0x5e, 0xa5, 0x0c, 0x74, 0x5e,
-	0xc2, 0x0c, 0x86, 0x5e, 0xe1, 0x0c, 0x8f, 0x5e, 0x00, 0x0d, 0xff, 0x5e, 0x1f, 0x0d, 0xc5, 0x60,
-	0x3e, 0x0d, 0xca, 0x60, 0x5d, 0x0d, 0x1a, 0x61, 0x7c, 0x0d, 0xac, 0x62, 0x99, 0x0d, 0x59, 0x65,
-	0xb8, 0x0d, 0xe5, 0x65, 0xd7, 0x0d, 0xe6, 0x65, 0xf4, 0x0d, 0xf6, 0x65, 0x11, 0x0e, 0x0e, 0x66,
-	0x30, 0x0e, 0x1f, 0x66, 0x4f, 0x0e, 0x25, 0x66, 0x6e, 0x0e, 0x91, 0x66, 0x8d, 0x0e, 0x08, 0x67,
-	0xac, 0x0e, 0x1f, 0x67, 0xcb, 0x0e, 0x11, 0x68, 0xea, 0x0e, 0xcd, 0x68, 0x09, 0x0f, 0x0d, 0x69,
-	0x28, 0x0f, 0x63, 0x6b, 0x47, 0x0f, 0xcd, 0x6b, 0x64, 0x0f, 0x34, 0x6c, 0x81, 0x0f, 0x05, 0x6e,
-	0xa0, 0x0f, 0xe1, 0x6e, 0xbf, 0x0f, 0x36, 0x72, 0xde, 0x0f, 0x7d, 0x76, 0xfd, 0x0f, 0xcb, 0x79,
-	0x1c, 0x10, 0xcd, 0x79, 0x3b, 0x10, 0xd2, 0x79, 0x5a, 0x10, 0x0b, 0x7a, 0x79, 0x10, 0xcb, 0x7a,
-	0x98, 0x10, 0xe5, 0x7a, 0xb7, 0x10, 0xef, 0x7a, 0xd6, 0x10, 0x4a, 0x81, 0xf5, 0x10, 0xf3, 0x81,
-	0x14, 0x11, 0x82, 0x82, 0x31, 0x11, 0x92, 0x82, 0x50, 0x11, 0xf0, 0x86, 0x6f, 0x11, 0xde, 0x8b,
-	0x8e, 0x11, 0x37, 0x8c, 0xad, 0x11, 0xcd, 0x91, 0xcc, 0x11, 0xf0, 0x95, 0xeb, 0x11, 0x33, 0x96,
-	0x0a, 0x12, 0x4d, 0x96, 0x27, 0x12, 0x64, 0x96, 0x46, 0x12, 0xe8, 0x96, 0x65, 0x12, 0xea, 0x96,
-	0x82, 0x12, 0x1c, 0x97, 0xa1, 0x12, 0x32, 0x97, 0xc0, 0x12, 0x52, 0x97, 0xdf, 0x12, 0x99, 0x9f,
-	0xfe, 0x12, 0x04, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x07, 0x01, 0x0b, 0x03, 0x03, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x06, 0x04, 0x03, 0x01, 0x02, 0x90, 0x90, 0x90,
-	0x07, 0x06, 0x0b, 0x00, 0x02, 0x48, 0x48, 0x48, 0xfc, 0x48, 0x48, 0x48, 0xfc, 0x48, 0x48, 0x48,
-	0x07, 0x05, 0x0b, 0x01, 0x02, 0x20, 0x70, 0xa8, 0xa0, 0x60, 0x30, 0x28, 0x28, 0xa8, 0x70, 0x20,
-	0x08, 0x07, 0x09, 0x00, 0x03, 0x42, 0xa4, 0xa8, 0x48, 0x10, 0x24, 0x2a, 0x4a, 0x84, 0x08, 0x07,
-	0x09, 0x00, 0x03, 0x30, 0x48, 0x48, 0x50, 0x20, 0x54, 0x88, 0x8c, 0x72, 0x05, 0x01, 0x03, 0x02,
-	0x02, 0x80, 0x80, 0x80, 0x07, 0x03, 0x0c, 0x02, 0x02, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x40, 0x40, 0x20, 0x07, 0x03, 0x0c, 0x02, 0x02, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x08, 0x07, 0x07, 0x00, 0x04, 0x10, 0x54, 0x38, 0xfe, 0x38,
-	0x54, 0x10, 0x07, 0x07, 0x07, 0x00, 0x04, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0x05, 0x02,
-	0x04, 0x01, 0x0a, 0xc0, 0xc0, 0x40, 0x80, 0x07, 0x06, 0x01, 0x00, 0x07, 0xfc, 0x05, 0x02, 0x02,
-	0x01, 0x0a, 0xc0, 0xc0, 0x07, 0x06, 0x0c, 0x00, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20,
-	0x20, 0x40, 0x40, 0x80, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84,
-	0x84, 0x84, 0x78, 0x06, 0x05, 0x09, 0x00, 0x03, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0xf8, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x84, 0x84, 0x08, 0x10, 0x20, 0x40, 0x80, 0xfc, 0x07,
-	0x06, 0x09, 0x00, 0x03, 0x78, 0x84, 0x04, 0x04, 0x38, 0x04, 0x04, 0x84, 0x78, 0x07, 0x06, 0x09,
-	0x00, 0x03, 0x18, 0x28, 0x48, 0x48, 0x88, 0x88, 0xfc, 0x08, 0x08, 0x07, 0x06, 0x09, 0x00, 0x03,
-	0xfc, 0x80, 0x80, 0xf8, 0x04, 0x04, 0x04, 0x84, 0x78, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x84,
-	0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0x78, 0x07, 0x06, 0x09, 0x00, 0x03, 0xfc, 0x08, 0x08, 0x10,
-	0x10, 0x10, 0x20, 0x20, 0x20, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x84, 0x84, 0x84, 0x78, 0x84,
-	0x84, 0x84, 0x78, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x84, 0x84, 0x84, 0x7c, 0x04, 0x04, 0x84,
-	0x78, 0x06, 0x02, 0x07, 0x02, 0x04, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x06, 0x02, 0x09,
-	0x02, 0x04, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x40, 0x80, 0x07, 0x06, 0x0b, 0x00, 0x03,
-	0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x07, 0x06, 0x04, 0x00, 0x06,
-	0xfc, 0x00, 0x00, 0xfc, 0x07, 0x06, 0x0b, 0x00, 0x03, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08,
-	0x10, 0x20, 0x40, 0x80, 0x07, 0x06, 0x0a, 0x00, 0x03, 0x78, 0x84, 0x84, 0x04, 0x18, 0x10, 0x10,
-	0x00, 0x10, 0x10, 0x0a, 0x09, 0x0a, 0x00, 0x02, 0x3e, 0x00, 0x41, 0x00, 0x9c, 0x80, 0xa2, 0x80,
-	0x9e, 0x80, 0xa2, 0x80, 0xa2, 0x80, 0x9e, 0x80, 0x41, 0x00, 0x3e, 0x00, 0x09, 0x08, 0x09, 0x00,
-	0x03, 0x18, 0x18, 0x24, 0x24, 0x42, 0x42, 0x7e, 0x81, 0x81, 0x07, 0x06, 0x09, 0x00, 0x03, 0xf8,
-	0x84, 0x84, 0x84, 0xf8, 0x84, 0x84, 0x84, 0xf8, 0x07, 0x06, 0x09, 0x00, 0x03, 0x3c, 0x40, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x40, 0x3c, 0x08, 0x07, 0x09, 0x00, 0x03, 0xf8, 0x84, 0x82, 0x82, 0x82,
-	0x82, 0x82, 0x84, 0xf8, 0x07, 0x06, 0x09, 0x00, 0x03, 0xfc, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80,
-	0x80, 0xfc, 0x07, 0x06, 0x09, 0x00, 0x03, 0xfc, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80, 0x80, 0x80,
-	0x08, 0x07, 0x09, 0x00, 0x03, 0x3c, 0x42, 0x80, 0x80, 0x8e, 0x82, 0x82, 0x42, 0x3e, 0x08, 0x07,
-	0x09, 0x00, 0x03, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x04, 0x03, 0x09, 0x00,
-	0x03, 0xe0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xe0, 0x04, 0x03, 0x0c, 0x00, 0x03, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x07, 0x06, 0x09, 0x00, 0x03,
-	0x84, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x84, 0x07, 0x06, 0x09, 0x00, 0x03, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x09, 0x08, 0x09, 0x00, 0x03, 0xc3, 0xc3, 0xa5, 0xa5,
-	0x99, 0x99, 0x81, 0x81, 0x81, 0x08, 0x07, 0x09, 0x00, 0x03, 0xc2, 0xc2, 0xa2, 0xa2, 0x92, 0x92,
-	0x8a, 0x8a, 0x86, 0x08, 0x07, 0x09, 0x00, 0x03, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44,
-	0x38, 0x07, 0x06, 0x09, 0x00, 0x03, 0xf8, 0x84, 0x84, 0x84, 0x84, 0xf8, 0x80, 0x80, 0x80, 0x08,
-	0x07, 0x0a, 0x00, 0x03, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x06, 0x07, 0x06,
-	0x09, 0x00, 0x03, 0xf8, 0x84, 0x84, 0x84, 0xf8, 0x90, 0x88, 0x88, 0x84, 0x07, 0x06, 0x09, 0x00,
-	0x03, 0x78, 0x84, 0x80, 0x80, 0x78, 0x04, 0x04, 0x84, 0x78, 0x08, 0x07, 0x09, 0x00, 0x03, 0xfe,
-	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, 0x09, 0x00, 0x03, 0x82, 0x82, 0x82,
-	0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x08, 0x07, 0x09, 0x00, 0x03, 0x82, 0x82, 0x82, 0x44, 0x44,
-	0x28, 0x28, 0x10, 0x10, 0x0c, 0x0b, 0x09, 0x00, 0x03, 0x84, 0x20, 0x84, 0x20, 0x8a, 0x20, 0x4a,
-	0x40, 0x51, 0x40, 0x51, 0x40, 0x51, 0x40, 0x20, 0x80, 0x20, 0x80, 0x08, 0x07, 0x09, 0x00, 0x03,
-	0x82, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x82, 0x08, 0x07, 0x09, 0x00, 0x03, 0x82, 0x44,
-	0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, 0x09, 0x00, 0x03, 0xfe, 0x02, 0x04, 0x08,
-	0x10, 0x20, 0x40, 0x80, 0xfe, 0x07, 0x03, 0x0c, 0x02, 0x01, 0xe0, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, 0x07, 0x05, 0x0a, 0x01, 0x02, 0x80, 0x80, 0x40, 0x40, 0x20,
-	0x20, 0x10, 0x10, 0x08, 0x08, 0x07, 0x03, 0x0c, 0x02, 0x01, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x07, 0x05, 0x03, 0x01, 0x02, 0x20, 0x50, 0x88, 0x07, 0x06,
-	0x01, 0x00, 0x0c, 0xfc, 0x07, 0x03, 0x03, 0x02, 0x03, 0xc0, 0x40, 0x20, 0x07, 0x06, 0x07, 0x00,
-	0x05, 0x78, 0x04, 0x7c, 0x84, 0x84, 0x84, 0x7c, 0x07, 0x06, 0x0a, 0x00, 0x02, 0x80, 0x80, 0x80,
-	0xb8, 0xc4, 0x84, 0x84, 0x84, 0xc4, 0xb8, 0x06, 0x05, 0x07, 0x00, 0x05, 0x78, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x78, 0x07, 0x06, 0x0a, 0x00, 0x02, 0x04, 0x04, 0x04, 0x74, 0x8c, 0x84, 0x84, 0x84,
-	0x8c, 0x74, 0x07, 0x06, 0x07, 0x00, 0x05, 0x78, 0x84, 0x84, 0xfc, 0x80, 0x84, 0x78, 0x06, 0x05,
-	0x0a, 0x00, 0x02, 0x38, 0x40, 0x40, 0xf8, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x07, 0x06, 0x0a,
-	0x00, 0x05, 0x7c, 0x84, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x04, 0x04, 0x78, 0x07, 0x06, 0x0a, 0x00,
-	0x02, 0x80, 0x80, 0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02, 0x01, 0x09, 0x00, 0x03,
-	0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x02, 0x0c, 0x00, 0x03, 0x40, 0x00,
-	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x06, 0x05, 0x0a, 0x00, 0x02, 0x80,
-	0x80, 0x80, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x03, 0x01, 0x0a, 0x01, 0x02, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0a, 0x09, 0x07, 0x00, 0x05, 0xb3, 0x00, 0xcc,
-	0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x07, 0x06, 0x07, 0x00, 0x05,
-	0xb8, 0xc4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x08, 0x07, 0x07, 0x00, 0x05, 0x38, 0x44, 0x82, 0x82,
-	0x82, 0x44, 0x38, 0x07, 0x06, 0x0a, 0x00, 0x05, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0xc4, 0xb8, 0x80,
-	0x80, 0x80, 0x07, 0x06, 0x0a, 0x00, 0x05, 0x74, 0x8c, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x04, 0x04,
-	0x04, 0x05, 0x04, 0x07, 0x00, 0x05, 0xb0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x06, 0x05, 0x07,
-	0x00, 0x05, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x05, 0x04, 0x09, 0x00, 0x03, 0x40, 0x40,
-	0xf0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x30, 0x07, 0x06, 0x07, 0x00, 0x05, 0x84, 0x84, 0x84, 0x84,
-	0x84, 0x8c, 0x74, 0x08, 0x07, 0x07, 0x00, 0x05, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x0a,
-	0x09, 0x07, 0x00, 0x05, 0x88, 0x80, 0x88, 0x80, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00,
-	0x22, 0x00, 0x06, 0x05, 0x07, 0x00, 0x05, 0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x08, 0x07,
-	0x0a, 0x00, 0x05, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x20, 0x20, 0x06, 0x05, 0x07,
-	0x00, 0x05, 0xf8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x07, 0x03, 0x0d, 0x02, 0x01, 0x20, 0x40,
-	0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x07, 0x01, 0x0c, 0x03, 0x01,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x07, 0x03, 0x0d, 0x02,
-	0x01, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x07, 0x05,
-	0x03, 0x01, 0x06, 0x40, 0xa8, 0x10, 0x0e, 0x0d, 0x01, 0x00, 0x06, 0xff, 0xf8, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x78, 0x0f, 0x80, 0xf4, 0x00,
-	0x04, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x03, 0xf8, 0x0e, 0x0d, 0x0c, 0x00,
-	0x01, 0xff, 0xf8, 0x08, 0x00, 0x08, 0x00, 0x0f, 0xe0, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10,
-	0x20, 0x10, 0x20, 0x20, 0x20, 0x43, 0x40, 0x80, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x7f, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x0e, 0x0b, 0x0e, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
-	0x00, 0xff, 0xe0, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0xff, 0xe0, 0x84, 0x20, 0x04, 0x00, 0x04,
-	0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00,
-	0x08, 0x40, 0xff, 0xe0, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40,
-	0x10, 0x48, 0x20, 0x48, 0xc0, 0x38, 0x0e, 0x0d, 0x09, 0x00, 0x02, 0x3f, 0xe0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x0e, 0x0d, 0x0c,
-	0x00, 0x01, 0x3f, 0xe0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x3f, 0xc0, 0x04, 0x40,
-	0x04, 0x40, 0x04, 0x40, 0x08, 0x40, 0x08, 0x40, 0xff, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04,
-	0x00, 0x02, 0x00, 0x7f, 0xf0, 0x10, 0x80, 0x09, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x7f, 0xf0, 0x02,
-	0x00, 0x12, 0x40, 0x22, 0x20, 0x42, 0x10, 0x0e, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04, 0x00,
-	0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x11, 0x00,
-	0x10, 0x80, 0x20, 0x40, 0x40, 0x38, 0x80, 0x10, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x08, 0x80, 0x08,
-	0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x10,
-	0x80, 0x10, 0x88, 0x20, 0x88, 0xc0, 0x78, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x3f, 0xe0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x10, 0x80, 0x10, 0x88,
-	0x20, 0x88, 0xc0, 0x78, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x22, 0x20, 0x12, 0x20, 0x12,
-	0x40, 0x02, 0x80, 0xff, 0xf8, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x11, 0x00, 0x11, 0x08, 0x21,
-	0x08, 0xc0, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
-	0x08, 0x80, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x20, 0x20, 0x20, 0x20, 0x40, 0x10,
-	0x80, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff,
-	0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x08, 0x40, 0x10, 0x20, 0x10, 0x20, 0x20, 0x10, 0x40,
-	0x10, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x0f, 0xc0, 0x10, 0x80, 0x29, 0x00, 0x46, 0x00,
-	0x05, 0x00, 0x18, 0xc0, 0xe0, 0x38, 0x06, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x01, 0x00,
-	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x08, 0x80, 0x10, 0x80, 0x10, 0x40, 0x20,
-	0x20, 0x5f, 0xd0, 0x84, 0x48, 0x04, 0x40, 0x08, 0x40, 0x08, 0x40, 0x11, 0x40, 0x60, 0x80, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x40, 0x00, 0x23, 0xf8, 0xf8, 0x88, 0x10, 0x88, 0x20, 0x88, 0x28, 0x88,
-	0x70, 0x88, 0xa8, 0x88, 0x21, 0x08, 0x21, 0x08, 0x22, 0x08, 0x24, 0x50, 0x28, 0x20, 0x0e, 0x0c,
-	0x0d, 0x00, 0x00, 0x00, 0x80, 0x78, 0x80, 0x00, 0x80, 0x03, 0xf0, 0xf8, 0x90, 0x20, 0x90, 0x20,
-	0x90, 0x48, 0x90, 0x45, 0x10, 0xfd, 0x10, 0x02, 0x10, 0x04, 0x50, 0x08, 0x20, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x08, 0x80, 0xff, 0xf8, 0x08, 0x80, 0x00, 0x00, 0x7f, 0xf8, 0x40, 0x08, 0x84, 0x10,
-	0x7f, 0xe0, 0x04, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0xa0, 0x60, 0x40, 0x0e, 0x0d, 0x0d, 0x00,
-	0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x02,
-	0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
-	0x10, 0x00, 0x10, 0x00, 0x1f, 0xf0, 0x22, 0x00, 0x42, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00,
-	0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0e, 0x0b, 0x0d, 0x01, 0x00, 0x3f,
-	0x80, 0x20, 0x80, 0x3f, 0x80, 0x00, 0x00, 0x7f, 0xc0, 0x40, 0x40, 0x44, 0x40, 0x44, 0x40, 0x44,
-	0x40, 0x4a, 0x40, 0x11, 0x00, 0x20, 0x80, 0xc0, 0x60, 0x0e, 0x0b, 0x0c, 0x01, 0x01, 0xff, 0xe0,
-	0x92, 0x20, 0x92, 0x20, 0x92, 0x20, 0x92, 0x20, 0xa2, 0x20, 0xc1, 0xe0, 0x80, 0x20, 0x80, 0x20,
-	0x80, 0x20, 0xff, 0xe0, 0x80, 0x20, 0x0e, 0x0b, 0x0d, 0x01, 0x00, 0xff, 0xe0, 0x80, 0x20, 0xbf,
-	0xa0, 0x84, 0x20, 0x84, 0x20, 0xbf, 0xa0, 0x84, 0x20, 0x85, 0x20, 0x84, 0xa0, 0xff, 0xe0, 0x80,
-	0x20, 0xff, 0xe0, 0x80, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x3f, 0xe0, 0x10, 0x40, 0x08, 0x80,
-	0x05, 0x00, 0x07, 0x00, 0x18, 0xc0, 0xe2, 0x38, 0x02, 0x00, 0x3f, 0xe0, 0x02, 0x00, 0x02, 0x00,
-	0x02, 0x00, 0xff, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x1e,
-	0x40, 0x22, 0x60, 0x22, 0x50, 0x54, 0x48, 0x94, 0x48, 0x08, 0x40, 0x14, 0x40, 0x22, 0x40, 0x41,
-	0x00, 0x80, 0xf8, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0xff, 0xf8, 0x04, 0x00, 0x3f, 0xe0, 0x20, 0x20,
-	0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x10, 0x00, 0x3f, 0xc0, 0x48, 0x80, 0x07, 0x00, 0xf8, 0xf8,
-	0x0e, 0x0c, 0x0d, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0xf0, 0x08, 0x20, 0x18, 0x20, 0x24,
-	0x40, 0x42, 0x40, 0x02, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x18, 0x00, 0xe0, 0x00, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x11, 0x00, 0x11, 0x00, 0x21, 0xf0, 0x22, 0x20,
-	0x64, 0xa0, 0xaa, 0x40, 0x21, 0x40, 0x20, 0x80, 0x21, 0x40, 0x22, 0x20, 0x3c, 0x18, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x02, 0x00, 0x05,
-	0x00, 0x05, 0x00, 0x08, 0x80, 0x08, 0x80, 0x10, 0x40, 0x20, 0x20, 0xc0, 0x18, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x02, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x12, 0x00, 0x02, 0x00, 0xff, 0xf8,
-	0x02, 0x00, 0x04, 0x80, 0x08, 0x40, 0x10, 0x20, 0x20, 0x10, 0xc0, 0x10, 0x0e, 0x0d, 0x0d, 0x00,
-	0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xff, 0xf8, 0x08, 0x80, 0x08, 0x80, 0x11, 0x00, 0x31,
-	0x00, 0x0a, 0x00, 0x06, 0x00, 0x09, 0x00, 0x10, 0xc0, 0xe0, 0x30, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
-	0x20, 0x00, 0x23, 0xf8, 0x20, 0x08, 0xfc, 0x08, 0x28, 0x08, 0x28, 0x08, 0x49, 0xf8, 0x48, 0x08,
-	0x30, 0x08, 0x10, 0x08, 0x28, 0x08, 0x47, 0xf8, 0x80, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04,
-	0x00, 0x02, 0x00, 0x7f, 0xf8, 0x40, 0x10, 0x84, 0x00, 0x04, 0x00, 0xff, 0xf8, 0x08, 0x80, 0x10,
-	0x80, 0x0d, 0x00, 0x03, 0x00, 0x0c, 0xc0, 0x70, 0x30, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00,
-	0x7f, 0xf8, 0x40, 0x08, 0x92, 0x20, 0x0a, 0x40, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x20, 0x20,
-	0x3f, 0xe0, 0x20, 0x20, 0x20, 0xa0, 0x20, 0x40, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0xff,
-	0xf8, 0x88, 0x88, 0x3f, 0xe0, 0x08, 0x80, 0x3f, 0xe0, 0x08, 0x80, 0xff, 0xf8, 0x10, 0x40, 0x26,
-	0x20, 0xc1, 0x98, 0x06, 0x00, 0x01, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
-	0x02, 0x00, 0x02, 0x00, 0x22, 0x40, 0x22, 0x20, 0x22, 0x10, 0x42, 0x08, 0x82, 0x08, 0x02, 0x00,
-	0x02, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x1f, 0xf8, 0x50,
-	0x80, 0x50, 0x80, 0x57, 0xf0, 0x54, 0x90, 0x54, 0x90, 0x54, 0x90, 0x54, 0x90, 0x14, 0x90, 0x24,
-	0xb0, 0x40, 0x80, 0x80, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x7f, 0xf0, 0x02, 0x00, 0x22, 0x20,
-	0x12, 0x40, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-	0x02, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x1f, 0xf8, 0x21, 0x00, 0x41,
-	0x00, 0x9f, 0xe0, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xff, 0xf8, 0x01, 0x00, 0x01, 0x00, 0x01,
-	0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x3f, 0xf8, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00,
-	0x3f, 0xf8, 0x21, 0x00, 0x22, 0x80, 0x22, 0x80, 0x24, 0x40, 0x48, 0x20, 0x50, 0x10, 0xa0, 0x08,
-	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x3f, 0xf8, 0x20, 0x00, 0x27, 0xe0, 0x21, 0x40, 0x20,
-	0x80, 0x3f, 0xf8, 0x20, 0x88, 0x20, 0x90, 0x20, 0x80, 0x40, 0x80, 0x42, 0x80, 0x81, 0x00, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xff, 0xf8, 0x10, 0x40,
-	0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x1f, 0xc0, 0x10, 0x40, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x20, 0x80, 0x27, 0xf8, 0xa0, 0x80, 0xb3, 0xf0, 0xa8, 0x80, 0xaf, 0xf8, 0x22,
-	0x10, 0x23, 0xf0, 0x22, 0x10, 0x23, 0xf0, 0x22, 0x10, 0x22, 0x10, 0x22, 0x30, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x21, 0x00, 0x20, 0x80, 0xa7, 0xf8, 0xb0, 0x00, 0xab, 0xf0, 0xa2, 0x10, 0x23, 0xf0,
-	0x20, 0x40, 0x24, 0x50, 0x24, 0x48, 0x28, 0x48, 0x21, 0x40, 0x20, 0x80, 0x0e, 0x0d, 0x0c, 0x00,
-	0x01, 0x1f, 0xc0, 0x12, 0x40, 0x1f, 0xc0, 0x12, 0x40, 0x7f, 0xf0, 0x42, 0x50, 0x5f, 0xd0, 0x40,
-	0x30, 0x12, 0x10, 0x51, 0x48, 0x90, 0x40, 0x0f, 0xc0, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x80,
-	0x20, 0x80, 0xf9, 0x00, 0x22, 0x10, 0x27, 0xf8, 0x28, 0x08, 0x33, 0xf0, 0xe2, 0x10, 0x22, 0x10,
-	0x22, 0x10, 0x22, 0x10, 0xa3, 0xf0, 0x42, 0x10, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x80, 0x24,
-	0x80, 0xfc, 0x80, 0x28, 0xf8, 0xfd, 0x20, 0x11, 0x20, 0x22, 0xa0, 0x78, 0xa0, 0x88, 0x40, 0x1c,
-	0x40, 0xf0, 0xa0, 0x11, 0x10, 0x32, 0x08, 0x0e, 0x09, 0x0c, 0x02, 0x01, 0xff, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0xff, 0x80, 0x80, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x1f, 0xc0, 0x10, 0x40, 0x10, 0x40, 0x10,
-	0x40, 0x1f, 0xc0, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0xf8, 0x0e, 0x0c, 0x0d, 0x01, 0x00, 0x00, 0x40, 0xf0, 0x40, 0x90, 0x40, 0x9f, 0xf0, 0x90, 0x40,
-	0xf4, 0x40, 0x92, 0x40, 0x92, 0x40, 0x90, 0x40, 0xf0, 0x40, 0x90, 0x40, 0x01, 0x40, 0x00, 0x80,
-	0x0e, 0x0c, 0x0d, 0x01, 0x00, 0x03, 0xf0, 0xfa, 0x10, 0x8a, 0x10, 0x8a, 0x10, 0xfb, 0xf0, 0x8a,
-	0x10, 0x8a, 0x10, 0x8b, 0xf0, 0xfa, 0x10, 0x8a, 0x10, 0x04, 0x10, 0x04, 0x50, 0x08, 0x20, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x02, 0x00,
-	0x22, 0x00, 0x3f, 0xf0, 0x42, 0x00, 0x3f, 0xe0, 0x02, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0x3f, 0xf0, 0x04, 0x00, 0xff, 0xf8, 0x10,
-	0x40, 0x3f, 0xe0, 0xd0, 0x58, 0x1f, 0xc0, 0x10, 0x40, 0x10, 0x40, 0x1f, 0xc0, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x04, 0x20, 0x3f, 0xc0,
-	0x04, 0x80, 0xff, 0xf8, 0x10, 0x40, 0x3f, 0xc0, 0xd0, 0x40, 0x1f, 0xc0, 0x0e, 0x09, 0x0d, 0x02,
-	0x00, 0x3f, 0x80, 0x20, 0x80, 0x20, 0x80, 0x3f, 0x80, 0x20, 0x80, 0x20, 0x80, 0x3f, 0x80, 0x20,
-	0x80, 0x20, 0x80, 0x20, 0x80, 0x40, 0x80, 0x42, 0x80, 0x81, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
-	0x44, 0x00, 0x44, 0xf8, 0xfe, 0x88, 0x44, 0x88, 0x7c, 0xf8, 0x44, 0x88, 0x7c, 0x88, 0x44, 0xf8,
-	0xff, 0x88, 0x00, 0x88, 0x44, 0x88, 0x43, 0x28, 0x82, 0x10, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20,
-	0x10, 0x20, 0x10, 0x27, 0x10, 0xf9, 0xf8, 0x25, 0x10, 0x75, 0x10, 0x6a, 0x90, 0xa2, 0x50, 0xa5,
-	0x10, 0x29, 0x10, 0x30, 0x10, 0x20, 0x50, 0x20, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x00,
-	0x27, 0xf0, 0x24, 0x10, 0xff, 0xf0, 0x24, 0x10, 0x77, 0xf0, 0x6c, 0x40, 0xa4, 0x48, 0xa7, 0x50,
-	0x24, 0x60, 0x25, 0x48, 0x26, 0x48, 0x24, 0x38, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x80, 0x20,
-	0x80, 0x27, 0xf8, 0xf8, 0x80, 0x23, 0xf0, 0x72, 0x10, 0x6b, 0xf0, 0xa2, 0x10, 0xa3, 0xf0, 0x22,
-	0x10, 0x23, 0xf0, 0x22, 0x10, 0x27, 0xf8, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0xff, 0xf8, 0x02, 0x00,
-	0x02, 0x00, 0x02, 0x00, 0x22, 0x00, 0x23, 0xf0, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
-	0x22, 0x00, 0xff, 0xf8, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x1f, 0xe0, 0x12, 0x20, 0x11, 0x20, 0x10,
-	0x20, 0xff, 0xf8, 0x22, 0x20, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3f, 0xf8, 0x00, 0x20, 0x00,
-	0xc0, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x20, 0x7a, 0x40, 0x0a, 0x80,
-	0x0b, 0x00, 0x13, 0x00, 0x12, 0x80, 0x22, 0x40, 0x42, 0x38, 0x82, 0x10, 0x0a, 0x00, 0x04, 0x00,
-	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0x80, 0x2f, 0xf8, 0x00, 0x80, 0x87, 0xf0, 0x40, 0x80, 0x1f,
-	0xf8, 0x24, 0x10, 0x27, 0xf0, 0xc4, 0x10, 0x47, 0xf0, 0x44, 0x10, 0x44, 0x50, 0x44, 0x20, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x42, 0x40, 0x2f, 0xf0, 0x02, 0x40, 0x9f, 0xf8, 0x42, 0x40, 0x1f, 0xf0,
-	0x2a, 0x50, 0x2a, 0x50, 0xcb, 0x50, 0x4c, 0xb0, 0x49, 0x10, 0x48, 0x50, 0x48, 0x20, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x10, 0x40, 0x10, 0x20, 0x20, 0x10, 0x50, 0x48, 0x90, 0x48, 0x08, 0x80, 0x08,
-	0x80, 0x05, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x80, 0x10, 0x40, 0xe0, 0x38, 0x0e, 0x0a, 0x0d,
-	0x02, 0x00, 0x10, 0x00, 0x20, 0x00, 0xff, 0xc0, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0xff, 0xc0,
-	0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0xff, 0xc0, 0x80, 0x40, 0x0e, 0x0d, 0x0d, 0x00,
-	0x00, 0x0c, 0x40, 0x70, 0x40, 0x10, 0x40, 0x11, 0x48, 0xfd, 0x48, 0x12, 0x50, 0x38, 0x40, 0x34,
-	0x40, 0x50, 0xa0, 0x50, 0xa0, 0x91, 0x10, 0x12, 0x10, 0x14, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
-	0x0c, 0x40, 0x70, 0x40, 0x10, 0x40, 0x13, 0xf8, 0xfe, 0x48, 0x12, 0x48, 0x32, 0x48, 0x5b, 0xf8,
-	0x94, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x18,
-	0x80, 0xe0, 0x80, 0x20, 0x80, 0x22, 0xa0, 0xfa, 0x90, 0x24, 0x88, 0x70, 0x80, 0x68, 0x90, 0xa0,
-	0x90, 0xa0, 0x20, 0x20, 0x40, 0x20, 0x80, 0x27, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x18, 0x00,
-	0xe3, 0xf0, 0x22, 0x10, 0x22, 0x10, 0xfb, 0xf0, 0x20, 0x00, 0x77, 0xf0, 0x68, 0x80, 0xa0, 0x80,
-	0xa3, 0xf0, 0x20, 0x80, 0x20, 0x80, 0x27, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x02,
-	0x00, 0x02, 0x00, 0x7f, 0xf0, 0x00, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x80, 0x08, 0x80, 0x08,
-	0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xf0,
-	0x10, 0x40, 0x08, 0x80, 0xff, 0xf8, 0x12, 0x40, 0x1f, 0xc0, 0x12, 0x40, 0x1f, 0xc0, 0x02, 0x00,
-	0x3f, 0xe0, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0x40, 0x22, 0x48, 0xfa,
-	0x48, 0x03, 0xf8, 0x88, 0x00, 0x4b, 0xf8, 0x50, 0x80, 0x13, 0xf8, 0x22, 0xa8, 0x1a, 0xa8, 0xe2,
-	0xa8, 0x02, 0xa8, 0x02, 0x18, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x01, 0x20, 0x79, 0x20, 0x4f, 0xf8,
-	0x49, 0x20, 0x7f, 0xf8, 0x48, 0x00, 0x4b, 0xf0, 0x7a, 0x10, 0x4b, 0xf0, 0x4a, 0x10, 0x4a, 0x10,
-	0xab, 0xf0, 0x92, 0x10, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0xff, 0xf8, 0x04, 0x00, 0x08, 0x00, 0x10,
-	0x40, 0x3f, 0xe0, 0x02, 0x20, 0x02, 0x00, 0x3f, 0xe0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xff,
-	0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x08, 0x80, 0xff, 0xf8, 0x08, 0x80, 0x00, 0x00, 0x7f, 0xf0,
-	0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x50, 0x02, 0x20, 0x02, 0x00, 0x02, 0x00,
-	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x80, 0xff, 0xf8, 0x10, 0x80, 0x10, 0x80, 0x04, 0x00, 0x02,
-	0x00, 0xff, 0xf8, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x1f, 0xe0, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x10, 0x80, 0x10, 0x80, 0xfb, 0xe0, 0x10, 0xa0, 0xfa, 0xa0, 0x11, 0x28,
-	0x52, 0x98, 0x24, 0x08, 0x3f, 0xe0, 0x22, 0x20, 0x3f, 0xe0, 0x02, 0x10, 0xff, 0xf8, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x40, 0x18, 0x2e, 0xe0, 0x22, 0x20, 0x04, 0x20, 0xe8, 0xb8, 0x2e, 0xa0, 0x22,
-	0xa0, 0x22, 0xa0, 0x2a, 0xa0, 0x24, 0xf8, 0x36, 0x00, 0x29, 0x00, 0x10, 0xf8, 0x0e, 0x0d, 0x0d,
-	0x00, 0x00, 0x08, 0x80, 0x10, 0x40, 0x22, 0x20, 0x45, 0x00, 0x08, 0x80, 0x10, 0x40, 0x20, 0x20,
-	0xdf, 0xd8, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x1f, 0xc0, 0x10, 0x40, 0x0e, 0x0d, 0x0d, 0x00,
-	0x00, 0x01, 0xf0, 0x7e, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x22, 0x20, 0x3f, 0xe0, 0x22, 0x20, 0x3f,
-	0xe0, 0x02, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x0c, 0x0d, 0x01, 0x00,
-	0x9f, 0xf0, 0x40, 0x10, 0x80, 0x10, 0xbf, 0xd0, 0x84, 0x10, 0x84, 0x10, 0x9f, 0x90, 0x84, 0x10,
-	0x84, 0x10, 0xbf, 0xd0, 0x80, 0x10, 0x80, 0x50, 0x80, 0x20, 0x0e, 0x0b, 0x0c, 0x01, 0x01, 0xf7,
-	0xe0, 0x94, 0x20, 0xa4, 0x20, 0xc4, 0x20, 0xa4, 0x20, 0x97, 0xe0, 0x94, 0x20, 0xd4, 0x20, 0xa4,
-	0x20, 0x84, 0x20, 0x87, 0xe0, 0x84, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0xf3, 0xf0,
-	0x95, 0x40, 0xa8, 0x80, 0xc1, 0x40, 0xae, 0xb8, 0x90, 0x80, 0x97, 0xf0, 0xd0, 0x80, 0xa4, 0x80,
-	0x87, 0xf0, 0x80, 0x80, 0x80, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x80, 0xf0, 0x80, 0x91,
-	0x40, 0xa2, 0x20, 0xc7, 0xf0, 0xa8, 0x88, 0x90, 0x80, 0x97, 0xf0, 0xd0, 0x80, 0xa4, 0x90, 0x84,
-	0x88, 0x88, 0x88, 0x81, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0xff, 0xf8, 0x02, 0x00, 0x02, 0x00,
-	0x7f, 0xf0, 0x42, 0x10, 0x52, 0x90, 0x4a, 0x50, 0x52, 0x90, 0x4a, 0x50, 0x42, 0x10, 0x42, 0x50,
-	0x42, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0x7f, 0xf8, 0x52, 0x48, 0x8a,
-	0x90, 0x12, 0x40, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x20, 0x3f, 0xe0, 0x00, 0x20, 0x3f, 0xe0, 0x00,
-	0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x92, 0x48, 0x22, 0x20,
-	0x10, 0x00, 0xff, 0xf0, 0x11, 0x10, 0x39, 0xf0, 0x55, 0x10, 0x93, 0xf0, 0x11, 0x10, 0x11, 0xf0,
-	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x92, 0x48, 0x22, 0x20, 0x79,
-	0xf0, 0x4b, 0x10, 0x78, 0xe0, 0x13, 0x18, 0x5d, 0xf0, 0x51, 0x10, 0x5d, 0x10, 0xe1, 0xf0, 0x0e,
-	0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xf0, 0x02, 0x00, 0x3f, 0xe0, 0x02, 0x00, 0xff, 0xf8,
-	0x20, 0x20, 0x3f, 0xe0, 0x20, 0x20, 0x3f, 0xe0, 0x20, 0x20, 0x20, 0xa0, 0x20, 0x40, 0x0e, 0x0d,
-	0x0d, 0x00, 0x00, 0x04, 0x00, 0x04, 0x80, 0x04, 0x40, 0xff, 0xf8, 0x04, 0x00, 0x05, 0x00, 0x05,
-	0x20, 0x09, 0x20, 0x09, 0x40, 0x11, 0x80, 0x23, 0x08, 0x45, 0x08, 0x88, 0xf8,
+#define sfont_size  4623
+static const unsigned char sfont[] __attribute__((aligned(4))) = {
+	0xbc, 0xf0, 0x20, 0x00, 0xf2, 0x02, 0x21, 0x00, 0xf9, 0x02, 0x22, 0x00, 0x01, 0x03, 0x23, 0x00,
+	0x0a, 0x03, 0x24, 0x00, 0x1a, 0x03, 0x25, 0x00, 0x2a, 0x03, 0x26, 0x00, 0x3e, 0x03, 0x27, 0x00,
+	0x52, 0x03, 0x28, 0x00, 0x59, 0x03, 0x29, 0x00, 0x65, 0x03, 0x2a, 0x00, 0x71, 0x03, 0x2b, 0x00,
+	0x7e, 0x03, 0x2c, 0x00, 0x87, 0x03, 0x2d, 0x00, 0x8f, 0x03, 0x2e, 0x00, 0x96, 0x03, 0x2f, 0x00,
+	0x9d, 0x03, 0x30, 0x00, 0xaf, 0x03, 0x31, 0x00, 0xbb, 0x03, 0x32, 0x00, 0xc7, 0x03, 0x33, 0x00,
+	0xd9, 0x03, 0x34, 0x00, 0xe7, 0x03, 0x35, 0x00, 0xf9, 0x03, 0x36, 0x00, 0x05, 0x04, 0x37, 0x00,
+	0x13, 0x04, 0x38, 0x00, 0x23, 0x04, 0x39, 0x00, 0x2f, 0x04, 0x3a, 0x00, 0x3b, 0x04, 0x3b, 0x00,
+	0x42, 0x04, 0x3c, 0x00, 0x4c, 0x04, 0x3d, 0x00, 0x5e, 0x04, 0x3e, 0x00, 0x65, 0x04, 0x3f, 0x00,
+	0x77, 0x04, 0x40, 0x00, 0x87, 0x04, 0x41, 0x00, 0x9c, 0x04, 0x42, 0x00, 0xb0, 0x04, 0x43, 0x00,
+	0xbc, 0x04, 0x44, 0x00, 0xc8, 0x04, 0x45, 0x00, 0xd6, 0x04, 0x46, 0x00, 0xe2, 0x04, 0x47, 0x00,
+	0xee, 0x04, 0x48, 0x00, 0xfe, 0x04, 0x49, 0x00, 0x0a, 0x05, 0x4a, 0x00, 0x16, 0x05, 0x4b, 0x00,
+	0x20, 0x05, 0x4c, 0x00, 0x32, 0x05, 0x4d, 0x00, 0x3c, 0x05, 0x4e, 0x00, 0x50, 0x05, 0x4f, 0x00,
+	0x64, 0x05, 0x50, 0x00, 0x74, 0x05, 0x51, 0x00, 0x80, 0x05, 0x52, 0x00, 0x90, 0x05, 0x53, 0x00,
+	0xa0, 0x05, 0x54, 0x00, 0xac, 0x05, 0x55, 0x00, 0xb8, 0x05, 0x56, 0x00, 0xc8, 0x05, 0x57, 0x00,
+	0xdc, 0x05, 0x58, 0x00, 0xf9, 0x05, 0x59, 0x00, 0x0d, 0x06, 0x5a, 0x00, 0x21, 0x06, 0x5b, 0x00,
+	0x35, 0x06, 0x5c, 0x00, 0x3f, 0x06, 0x5d, 0x00, 0x4f, 0x06, 0x5e, 0x00, 0x59, 0x06, 0x5f, 0x00,
+	0x64, 0x06, 0x60, 0x00, 0x6b, 0x06, 0x61, 0x00, 0x74, 0x06, 0x62, 0x00, 0x7d, 0x06, 0x63, 0x00,
+	0x8b, 0x06, 0x64, 0x00, 0x93, 0x06, 0x65, 0x00, 0xa1, 0x06, 0x66, 0x00, 0xaa, 0x06, 0x67, 0x00,
+	0xb6, 0x06, 0x68, 0x00, 0xc4, 0x06, 0x69, 0x00, 0xd2, 0x06, 0x6a, 0x00, 0xda, 0x06, 0x6b, 0x00,
+	0xe4, 0x06, 0x6c, 0x00, 0xf4, 0x06, 0x6d, 0x00, 0xfc, 0x06, 0x6e, 0x00, 0x0a, 0x07, 0x6f, 0x00,
+	0x14, 0x07, 0x70, 0x00, 0x1f, 0x07, 0x71, 0x00, 0x2d, 0x07, 0x72, 0x00, 0x3b, 0x07, 0x73, 0x00,
+	0x44, 0x07, 0x74, 0x00, 0x4d, 0x07, 0x75, 0x00, 0x59, 0x07, 0x76, 0x00, 0x63, 0x07, 0x77, 0x00,
+	0x70, 0x07, 0x78, 0x00, 0x80, 0x07, 0x79, 0x00, 0x8b, 0x07, 0x7a, 0x00, 0x9f, 0x07, 0x7b, 0x00,
+	0xaa, 0x07, 0x7c, 0x00, 0xb6, 0x07, 0x7d, 0x00, 0xbe, 0x07, 0x7e, 0x00, 0xca, 0x07, 0x00, 0x4e,
+	0xd5, 0x07, 0x03, 0x4e, 0xdd, 0x07, 0x07, 0x4e, 0xf0, 0x07, 0x09, 0x4e, 0x0d, 0x08, 0x2d, 0x4e,
+	0x1e, 0x08, 0x5d, 0x4e, 0x2f, 0x08, 0x8c, 0x4e, 0x48, 0x08, 0x94, 0x4e, 0x55, 0x08, 0xb2, 0x4e,
+	0x6e, 0x08, 0xba, 0x4e, 0x8f, 0x08, 0x3f, 0x51, 0xb0, 0x08, 0x43, 0x51, 0xc7, 0x08, 0x49, 0x51,
+	0xe0, 0x08, 0x6b, 0x51, 0xff, 0x08, 0x6d, 0x51, 0x1c, 0x09, 0xac, 0x51, 0x3d, 0x09, 0x06, 0x52,
+	0x5a, 0x09, 0x1d, 0x52, 0x7b, 0x09, 0xa8, 0x52, 0x9c, 0x09, 0xb3, 0x52, 0xbb, 0x09, 0x41, 0x53,
+	0xda, 0x09, 0x48, 0x53, 0xe7, 0x09, 0x58, 0x54, 0xfe, 0x09, 0xdb, 0x56, 0x1b, 0x0a, 0xfd, 0x56,
+	0x32, 0x0a, 0x23, 0x57, 0x4b, 0x0a, 0x04, 0x59, 0x68, 0x0a, 0x0f, 0x59, 0x89, 0x0a, 0x15, 0x59,
+	0xa6, 0x0a, 0x1c, 0x59, 0xc5, 0x0a, 0x27, 0x59, 0xe6, 0x0a, 0x34, 0x59, 0x03, 0x0b, 0x73, 0x59,
+	0x22, 0x0b, 0x87, 0x59, 0x3f, 0x0b, 0x89, 0x5b, 0x58, 0x0b, 0xb5, 0x5b, 0x79, 0x0b, 0xd2, 0x5b,
+	0x9a, 0x0b, 0x0f, 0x5c, 0xbb, 0x0b, 0x08, 0x5e, 0xda, 0x0b, 0x73, 0x5e, 0xf9, 0x0b, 0x74, 0x5e,
+	0x16, 0x0c, 0x86, 0x5e, 0x2d, 0x0c, 0x8f, 0x5e, 0x4e, 0x0c, 0xff, 0x5e, 0x6d, 0x0c, 0xc5, 0x60,
+	0x7e, 0x0c, 0xca, 0x60, 0x9f, 0x0c, 0x1a, 0x61, 0xc0, 0x0c, 0xac, 0x62, 0xdf, 0x0c, 0x59, 0x65,
+	0xfe, 0x0c, 0xe5, 0x65, 0x1f, 0x0d, 0xe6, 0x65, 0x2c, 0x0d, 0xf6, 0x65, 0x3d, 0x0d, 0x0e, 0x66,
+	0x58, 0x0d, 0x1f, 0x66, 0x71, 0x0d, 0x25, 0x66, 0x8a, 0x0d, 0x91, 0x66, 0xa9, 0x0d, 0x08, 0x67,
+	0xc4, 0x0d, 0x1f, 0x67, 0xd9, 0x0d, 0x11, 0x68, 0xf6, 0x0d, 0xcd, 0x68, 0x17, 0x0e, 0x0d, 0x69,
+	0x38, 0x0e, 0x63, 0x6b, 0x57, 0x0e, 0xcd, 0x6b, 0x6a, 0x0e, 0x34, 0x6c, 0x83, 0x0e, 0x05, 0x6e,
+	0xa4, 0x0e, 0xe1, 0x6e, 0xc3, 0x0e, 0x36, 0x72, 0xe4, 0x0e, 0x7d, 0x76, 0x05, 0x0f, 0xcb, 0x79,
+	0x18, 0x0f, 0xcd, 0x79, 0x39, 0x0f, 0xd2, 0x79, 0x56, 0x0f, 0x0b, 0x7a, 0x77, 0x0f, 0xcb, 0x7a,
+	0x96, 0x0f, 0xe5, 0x7a, 0xb3, 0x0f, 0xef, 0x7a, 0xd4, 0x0f, 0x4a, 0x81, 0xf5, 0x0f, 0xf3, 0x81,
+	0x14, 0x10, 0x82, 0x82, 0x2f, 0x10, 0x92, 0x82, 0x4c, 0x10, 0xf0, 0x86, 0x65, 0x10, 0xde, 0x8b,
+	0x86, 0x10, 0x37, 0x8c, 0xa5, 0x10, 0xcd, 0x91, 0xc4, 0x10, 0xf0, 0x95, 0xdd, 0x10, 0x33, 0x96,
+	0xf6, 0x10, 0x4d, 0x96, 0x0d, 0x11, 0x64, 0x96, 0x2c, 0x11, 0xe8, 0x96, 0x4d, 0x11, 0xea, 0x96,
+	0x6e, 0x11, 0x1c, 0x97, 0x8f, 0x11, 0x32, 0x97, 0xb0, 0x11, 0x52, 0x97, 0xd1, 0x11, 0x99, 0x9f,
+	0xee, 0x11, 0x04, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x07, 0x01, 0x0b, 0x03, 0x03, 0x00, 0xfe,
+	0x60, 0x06, 0x04, 0x03, 0x01, 0x02, 0x20, 0xe0, 0x00, 0xe0, 0x07, 0x06, 0x0b, 0x00, 0x02, 0x10,
+	0x11, 0x00, 0xff, 0xe0, 0x11, 0x00, 0xff, 0xe0, 0x11, 0x00, 0x07, 0x05, 0x0b, 0x01, 0x02, 0x00,
+	0x23, 0x80, 0x44, 0x40, 0xff, 0xe0, 0x48, 0x40, 0x30, 0x80, 0x08, 0x07, 0x09, 0x00, 0x03, 0x00,
+	0x83, 0x00, 0x44, 0x80, 0x33, 0x00, 0x08, 0x00, 0x66, 0x00, 0x91, 0x00, 0x60, 0x80, 0x08, 0x07,
+	0x09, 0x00, 0x03, 0x00, 0x00, 0x80, 0x05, 0x00, 0x63, 0x00, 0x94, 0x80, 0x88, 0x80, 0x74, 0x80,
+	0x03, 0x00, 0x05, 0x01, 0x03, 0x02, 0x02, 0x00, 0xe0, 0x07, 0x03, 0x0c, 0x02, 0x02, 0x00, 0x80,
+	0x10, 0x60, 0x60, 0x1f, 0x80, 0x07, 0x03, 0x0c, 0x02, 0x02, 0x00, 0x1f, 0x80, 0x60, 0x60, 0x80,
+	0x10, 0x08, 0x07, 0x07, 0x00, 0x04, 0x00, 0x10, 0x54, 0x38, 0xfe, 0x38, 0x54, 0x10, 0x07, 0x07,
+	0x07, 0x00, 0x04, 0x66, 0x10, 0xfe, 0x10, 0x05, 0x02, 0x04, 0x01, 0x0a, 0x00, 0xe0, 0xd0, 0x07,
+	0x06, 0x01, 0x00, 0x07, 0x7c, 0x80, 0x05, 0x02, 0x02, 0x01, 0x0a, 0x40, 0xc0, 0x07, 0x06, 0x0c,
+	0x00, 0x02, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x00, 0x30, 0x07,
+	0x06, 0x09, 0x00, 0x03, 0x38, 0x7f, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x06, 0x05, 0x09, 0x00, 0x03,
+	0x48, 0x00, 0x80, 0xff, 0x80, 0x80, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x00, 0x60, 0x80, 0x90,
+	0x80, 0x88, 0x80, 0x84, 0x80, 0x82, 0x80, 0x61, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x30, 0x77,
+	0x00, 0x88, 0x80, 0x80, 0x80, 0x41, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x00, 0x02, 0x00, 0xff,
+	0x80, 0x82, 0x00, 0x42, 0x00, 0x32, 0x00, 0x0e, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x8f,
+	0x00, 0x90, 0x80, 0xf1, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x30, 0x4f, 0x00, 0x90, 0x80, 0x88,
+	0x80, 0x7f, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x04, 0x80, 0x00, 0xe0, 0x00, 0x9c, 0x00, 0x83,
+	0x80, 0x80, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x77, 0x00, 0x88, 0x80, 0x77, 0x00, 0x07,
+	0x06, 0x09, 0x00, 0x03, 0x38, 0x7f, 0x00, 0x88, 0x80, 0x71, 0x00, 0x06, 0x02, 0x07, 0x02, 0x04,
+	0x40, 0xc6, 0x06, 0x02, 0x09, 0x02, 0x04, 0x00, 0xc7, 0x00, 0xc6, 0x80, 0x07, 0x06, 0x0b, 0x00,
+	0x03, 0x00, 0x80, 0x20, 0x40, 0x40, 0x20, 0x80, 0x11, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x07, 0x06,
+	0x04, 0x00, 0x06, 0x7c, 0x90, 0x07, 0x06, 0x0b, 0x00, 0x03, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x11,
+	0x00, 0x20, 0x80, 0x40, 0x40, 0x80, 0x20, 0x07, 0x06, 0x0a, 0x00, 0x03, 0x08, 0x70, 0x00, 0x88,
+	0x00, 0x8e, 0xc0, 0x80, 0x00, 0x60, 0x00, 0x0a, 0x09, 0x0a, 0x00, 0x02, 0x0c, 0x00, 0x3f, 0x00,
+	0x40, 0x80, 0x9f, 0x40, 0xa9, 0x40, 0x96, 0x40, 0x40, 0x80, 0x3f, 0x00, 0x09, 0x08, 0x09, 0x00,
+	0x03, 0x08, 0x01, 0x80, 0x0e, 0x00, 0x32, 0x00, 0xc2, 0x00, 0x32, 0x00, 0x0e, 0x00, 0x01, 0x80,
+	0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x77, 0x00, 0x88, 0x80, 0xff, 0x80, 0x07, 0x06, 0x09, 0x00,
+	0x03, 0x70, 0x80, 0x80, 0x41, 0x00, 0x3e, 0x00, 0x08, 0x07, 0x09, 0x00, 0x03, 0x1c, 0x3e, 0x00,
+	0x41, 0x00, 0x80, 0x80, 0xff, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x80, 0x80, 0x88, 0x80,
+	0xff, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x80, 0x00, 0x88, 0x00, 0xff, 0x80, 0x08, 0x07,
+	0x09, 0x00, 0x03, 0x28, 0x4f, 0x80, 0x88, 0x80, 0x80, 0x80, 0x41, 0x00, 0x3e, 0x00, 0x08, 0x07,
+	0x09, 0x00, 0x03, 0x3c, 0xff, 0x80, 0x08, 0x00, 0xff, 0x80, 0x04, 0x03, 0x09, 0x00, 0x03, 0x00,
+	0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x03, 0x0c, 0x00, 0x03, 0x20, 0xff, 0xe0, 0x00, 0x10,
+	0x07, 0x06, 0x09, 0x00, 0x03, 0x00, 0x80, 0x80, 0x41, 0x00, 0x22, 0x00, 0x14, 0x00, 0x08, 0x00,
+	0xff, 0x80, 0x07, 0x06, 0x09, 0x00, 0x03, 0x78, 0x00, 0x80, 0xff, 0x80, 0x09, 0x08, 0x09, 0x00,
+	0x03, 0x08, 0xff, 0x80, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xff, 0x80,
+	0x08, 0x07, 0x09, 0x00, 0x03, 0x00, 0xff, 0x80, 0x00, 0x80, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
+	0xc0, 0x00, 0xff, 0x80, 0x08, 0x07, 0x09, 0x00, 0x03, 0x18, 0x3e, 0x00, 0x41, 0x00, 0x80, 0x80,
+	0x41, 0x00, 0x3e, 0x00, 0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x78, 0x00, 0x84, 0x00, 0xff, 0x80,
+	0x08, 0x07, 0x0a, 0x00, 0x03, 0x18, 0x3e, 0x40, 0x41, 0x40, 0x80, 0x80, 0x41, 0x00, 0x3e, 0x00,
+	0x07, 0x06, 0x09, 0x00, 0x03, 0x08, 0x70, 0x80, 0x8b, 0x00, 0x8c, 0x00, 0x88, 0x00, 0xff, 0x80,
+	0x07, 0x06, 0x09, 0x00, 0x03, 0x38, 0x47, 0x00, 0x88, 0x80, 0x71, 0x00, 0x08, 0x07, 0x09, 0x00,
+	0x03, 0x66, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0x08, 0x07, 0x09, 0x00, 0x03, 0x18, 0xfe, 0x00,
+	0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x08, 0x07, 0x09, 0x00, 0x03, 0x00, 0xe0, 0x00,
+	0x18, 0x00, 0x06, 0x00, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xe0, 0x00, 0x0c, 0x0b, 0x09, 0x00,
+	0x03, 0x00, 0x00, 0xe0, 0x00, 0x1e, 0x00, 0x01, 0x80, 0x0e, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x30,
+	0x00, 0x0e, 0x00, 0x01, 0x80, 0x1e, 0x00, 0xe0, 0x00, 0x08, 0x07, 0x09, 0x00, 0x03, 0x00, 0xc1,
+	0x80, 0x22, 0x00, 0x14, 0x00, 0x08, 0x00, 0x14, 0x00, 0x22, 0x00, 0xc1, 0x80, 0x08, 0x07, 0x09,
+	0x00, 0x03, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x1f, 0x80, 0x20, 0x00, 0x40, 0x00, 0x80,
+	0x00, 0x08, 0x07, 0x09, 0x00, 0x03, 0x00, 0xc0, 0x80, 0xa0, 0x80, 0x90, 0x80, 0x88, 0x80, 0x84,
+	0x80, 0x82, 0x80, 0x81, 0x80, 0x07, 0x03, 0x0c, 0x02, 0x01, 0x40, 0x80, 0x10, 0xff, 0xf0, 0x07,
+	0x05, 0x0a, 0x01, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x07,
+	0x03, 0x0c, 0x02, 0x01, 0x20, 0xff, 0xf0, 0x80, 0x10, 0x07, 0x05, 0x03, 0x01, 0x02, 0x00, 0x20,
+	0x40, 0x80, 0x40, 0x20, 0x07, 0x06, 0x01, 0x00, 0x0c, 0x7c, 0x80, 0x07, 0x03, 0x03, 0x02, 0x03,
+	0x00, 0x20, 0xc0, 0x80, 0x07, 0x06, 0x07, 0x00, 0x05, 0x38, 0x7e, 0xa2, 0x1c, 0x07, 0x06, 0x0a,
+	0x00, 0x02, 0x30, 0x0f, 0x80, 0x10, 0x40, 0x08, 0x80, 0xff, 0xc0, 0x06, 0x05, 0x07, 0x00, 0x05,
+	0x70, 0x82, 0x7c, 0x07, 0x06, 0x0a, 0x00, 0x02, 0x18, 0xff, 0xc0, 0x08, 0x80, 0x10, 0x40, 0x0f,
+	0x80, 0x07, 0x06, 0x07, 0x00, 0x05, 0x38, 0x74, 0x92, 0x7c, 0x06, 0x05, 0x0a, 0x00, 0x02, 0x60,
+	0x90, 0x00, 0x7f, 0xc0, 0x10, 0x00, 0x07, 0x06, 0x0a, 0x00, 0x05, 0x18, 0xff, 0x80, 0x84, 0x40,
+	0x82, 0x40, 0x7c, 0x00, 0x07, 0x06, 0x0a, 0x00, 0x02, 0x30, 0x0f, 0xc0, 0x10, 0x00, 0x08, 0x00,
+	0xff, 0xc0, 0x02, 0x01, 0x09, 0x00, 0x03, 0x00, 0xbf, 0x80, 0x03, 0x02, 0x0c, 0x00, 0x03, 0x00,
+	0xbf, 0xe0, 0x00, 0x10, 0x06, 0x05, 0x0a, 0x00, 0x02, 0x00, 0x10, 0x40, 0x08, 0x80, 0x05, 0x00,
+	0x02, 0x00, 0xff, 0xc0, 0x03, 0x01, 0x0a, 0x01, 0x02, 0x00, 0xff, 0xc0, 0x0a, 0x09, 0x07, 0x00,
+	0x05, 0x22, 0x00, 0x7e, 0x80, 0x40, 0x7e, 0x80, 0x40, 0xfe, 0x07, 0x06, 0x07, 0x00, 0x05, 0x30,
+	0x7e, 0x80, 0x40, 0xfe, 0x08, 0x07, 0x07, 0x00, 0x05, 0x18, 0x38, 0x44, 0x82, 0x44, 0x38, 0x07,
+	0x06, 0x0a, 0x00, 0x05, 0x30, 0x7c, 0x00, 0x82, 0x00, 0x44, 0x00, 0xff, 0xc0, 0x07, 0x06, 0x0a,
+	0x00, 0x05, 0x18, 0xff, 0xc0, 0x44, 0x00, 0x82, 0x00, 0x7c, 0x00, 0x05, 0x04, 0x07, 0x00, 0x05,
+	0x40, 0x80, 0x40, 0xfe, 0x06, 0x05, 0x07, 0x00, 0x05, 0x30, 0x4c, 0x92, 0x64, 0x05, 0x04, 0x09,
+	0x00, 0x03, 0x40, 0x20, 0x80, 0xff, 0x00, 0x20, 0x00, 0x07, 0x06, 0x07, 0x00, 0x05, 0x18, 0xfe,
+	0x04, 0x02, 0xfc, 0x08, 0x07, 0x07, 0x00, 0x05, 0x00, 0x80, 0x60, 0x18, 0x06, 0x18, 0x60, 0x80,
+	0x0a, 0x09, 0x07, 0x00, 0x05, 0x00, 0x00, 0xc0, 0x38, 0x06, 0x38, 0xc0, 0x38, 0x06, 0x38, 0xc0,
+	0x06, 0x05, 0x07, 0x00, 0x05, 0x00, 0xc6, 0x28, 0x10, 0x28, 0xc6, 0x08, 0x07, 0x0a, 0x00, 0x05,
+	0x00, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x0c, 0xc0, 0x30, 0x00, 0xc0, 0x00, 0x06,
+	0x05, 0x07, 0x00, 0x05, 0x00, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x07, 0x03, 0x0d, 0x02, 0x01, 0x00,
+	0x80, 0x08, 0x7c, 0xf0, 0x03, 0x00, 0x07, 0x01, 0x0c, 0x03, 0x01, 0x00, 0xff, 0xf0, 0x07, 0x03,
+	0x0d, 0x02, 0x01, 0x00, 0x03, 0x00, 0x7c, 0xf0, 0x80, 0x08, 0x07, 0x05, 0x03, 0x01, 0x06, 0x00,
+	0x40, 0x20, 0x40, 0x80, 0x40, 0x0e, 0x0d, 0x01, 0x00, 0x06, 0x7f, 0xf8, 0x80, 0x0e, 0x0d, 0x0d,
+	0x00, 0x00, 0x36, 0x38, 0x08, 0xf8, 0x08, 0x08, 0x04, 0x08, 0xff, 0xf0, 0x04, 0x00, 0x02, 0x00,
+	0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x42, 0x00, 0x80, 0x00, 0x9f, 0xc0, 0x90, 0x20, 0x90, 0x10, 0x90,
+	0x20, 0x90, 0x00, 0xfe, 0x00, 0x81, 0x80, 0x80, 0x40, 0x80, 0x20, 0x80, 0x10, 0x0e, 0x0d, 0x0c,
+	0x00, 0x01, 0x1f, 0xe0, 0x00, 0x10, 0x80, 0x10, 0x84, 0x10, 0x80, 0x10, 0x00, 0x10, 0x0e, 0x0b,
+	0x0e, 0x01, 0x00, 0x39, 0xc0, 0x1f, 0x80, 0x11, 0x00, 0xff, 0xfc, 0x11, 0x00, 0x1f, 0x80, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x07, 0x08, 0x00, 0x38, 0x00, 0x08, 0x10, 0x08, 0x3f, 0xf0, 0x10, 0x00,
+	0xff, 0x00, 0x10, 0xe0, 0x10, 0x10, 0x10, 0x08, 0x0e, 0x0d, 0x09, 0x00, 0x02, 0x5f, 0xe8, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x44, 0x28, 0x00, 0x10, 0x80, 0x10,
+	0x87, 0xf0, 0x84, 0x10, 0xfc, 0x10, 0x87, 0x90, 0x84, 0x70, 0x84, 0x10, 0x00, 0x10, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x25, 0x10, 0x25, 0x20, 0x25, 0x40, 0x35, 0x00, 0x2d,
+	0x00, 0x67, 0xf8, 0xa5, 0x08, 0x2d, 0x08, 0x35, 0x40, 0x25, 0x20, 0x25, 0x10, 0x04, 0x00, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40,
+	0x00, 0x80, 0x03, 0x00, 0xfc, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08,
+	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x33, 0x08, 0x00, 0x38, 0x00, 0x08, 0xff, 0xf0, 0x00, 0x00, 0xff,
+	0x80, 0x00, 0x60, 0x00, 0x10, 0x00, 0x08, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x13, 0x08, 0x08, 0x70,
+	0x08, 0x10, 0x88, 0x10, 0x8f, 0xe0, 0x88, 0x00, 0x8f, 0x00, 0x88, 0xc0, 0x88, 0x20, 0x08, 0x10,
+	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x04, 0x38, 0x04, 0x08, 0x64, 0x08, 0x14, 0x08, 0x0c,
+	0x08, 0x07, 0xf0, 0xfc, 0x00, 0x04, 0x00, 0x07, 0x80, 0x34, 0x60, 0x44, 0x10, 0x04, 0x08, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x60, 0x07, 0x80, 0xf8, 0x00,
+	0x00, 0x00, 0x7c, 0x00, 0x03, 0x80, 0x00, 0x60, 0x00, 0x10, 0x00, 0x08, 0x0e, 0x0d, 0x0d, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x18, 0x08, 0x60, 0x08, 0x80, 0x09, 0x00, 0x08, 0x00, 0x68,
+	0x00, 0x88, 0x00, 0x09, 0x80, 0x08, 0x60, 0x08, 0x10, 0x08, 0x08, 0x08, 0x00, 0x0e, 0x0d, 0x0d,
+	0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0x42, 0x00, 0x62, 0x00, 0x54, 0x48, 0x48, 0x90, 0x4c, 0xa0,
+	0xd2, 0x20, 0x22, 0x00, 0x11, 0x00, 0x09, 0x00, 0x01, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0b, 0xf0, 0x32, 0x08, 0xc2, 0x10, 0x02, 0x00, 0x03,
+	0x80, 0x62, 0x60, 0x1a, 0x10, 0x04, 0x08, 0x02, 0x08, 0x01, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
+	0x00, 0x00, 0x7f, 0xe0, 0x40, 0x10, 0x40, 0x08, 0x40, 0x10, 0x7f, 0x00, 0x40, 0xc0, 0x40, 0x20,
+	0x00, 0x10, 0x25, 0x08, 0x32, 0x00, 0x6f, 0xf8, 0xa2, 0x00, 0x21, 0x00, 0x0e, 0x0c, 0x0d, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0xf0, 0x10, 0x08, 0x10, 0x10, 0xff, 0x00, 0x10, 0xc0, 0x10, 0x20, 0x00,
+	0xd0, 0x49, 0x48, 0x48, 0x40, 0x4e, 0x40, 0x49, 0xc0, 0x08, 0x40, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
+	0x02, 0x00, 0x4c, 0x00, 0x4a, 0x00, 0x49, 0xf0, 0x49, 0x08, 0xe9, 0x10, 0x49, 0x00, 0x4b, 0x80,
+	0xe9, 0x60, 0x49, 0x10, 0x49, 0x08, 0x4d, 0x08, 0x42, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x7c,
+	0xf8, 0x04, 0x00, 0xff, 0xf8, 0x04, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x3c, 0x80, 0x02, 0x00,
+	0x22, 0x00, 0x3f, 0xf8, 0x22, 0x00, 0xe2, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x0e, 0x0b,
+	0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0xc8, 0xe8, 0x10, 0xa8, 0x20, 0xa8, 0x40, 0xab,
+	0x80, 0xa8, 0x40, 0xa8, 0x20, 0xe8, 0x10, 0x0f, 0xc8, 0x00, 0x08, 0x0e, 0x0b, 0x0c, 0x01, 0x01,
+	0x32, 0x00, 0xff, 0xf0, 0x82, 0x20, 0xfc, 0x20, 0x80, 0x20, 0xf8, 0x20, 0x84, 0x20, 0x82, 0x20,
+	0xff, 0xf0, 0x0e, 0x0b, 0x0d, 0x01, 0x00, 0x01, 0x80, 0xff, 0xf8, 0x80, 0x50, 0xa4, 0xd0, 0xa5,
+	0x50, 0xa4, 0x50, 0xbf, 0xd0, 0xa4, 0x50, 0x80, 0x50, 0xff, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
+	0x40, 0x08, 0x02, 0x08, 0x82, 0x88, 0xc4, 0x88, 0xa4, 0x88, 0x98, 0x88, 0x8b, 0xf8, 0x98, 0x88,
+	0xa4, 0x88, 0xc4, 0x88, 0x82, 0x88, 0x02, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x08, 0x04, 0x08, 0x08, 0x08, 0xff, 0xe8, 0x00, 0x08, 0x00, 0x10, 0x1c, 0x20, 0x13, 0x40, 0x10,
+	0x80, 0xf3, 0x40, 0x0c, 0x20, 0x02, 0x10, 0x01, 0x08, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x42, 0x00,
+	0x80, 0x10, 0xbe, 0x10, 0xaa, 0x90, 0xaa, 0xd0, 0xaa, 0xa0, 0xea, 0xa0, 0xaa, 0xd0, 0xab, 0x90,
+	0xbe, 0x90, 0x80, 0x50, 0x80, 0x10, 0x0e, 0x0c, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x38,
+	0x00, 0x26, 0x00, 0x21, 0x00, 0x20, 0x80, 0x23, 0x40, 0xe4, 0x20, 0x18, 0x10, 0x08, 0x10, 0x04,
+	0x08, 0x02, 0x08, 0x00, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x48, 0x08,
+	0x4e, 0x10, 0x49, 0xa0, 0x4a, 0x40, 0x78, 0xa0, 0xc5, 0x10, 0x42, 0x08, 0x41, 0x08, 0x70, 0x08,
+	0x4f, 0xf8, 0x42, 0x00, 0x41, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0x08, 0x10, 0x08, 0x10,
+	0x10, 0x10, 0x20, 0x10, 0xc0, 0x13, 0x00, 0xfc, 0x00, 0x13, 0x00, 0x10, 0xc0, 0x10, 0x20, 0x10,
+	0x10, 0x10, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x02, 0x18, 0x02, 0x20,
+	0x02, 0x40, 0x02, 0x80, 0x02, 0x00, 0xff, 0x00, 0x02, 0x80, 0x22, 0x40, 0x4a, 0x20, 0x12, 0x10,
+	0x02, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x08, 0x10, 0x00, 0x10, 0x08, 0x10, 0x10, 0x1c,
+	0x10, 0x13, 0x20, 0x10, 0xc0, 0xf0, 0x40, 0x1c, 0xa0, 0x13, 0x10, 0x11, 0x08, 0x10, 0x08, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x3c, 0x00, 0x7f, 0xf8, 0x42, 0x10, 0x40, 0x10, 0x10, 0x10, 0x1f, 0x20,
+	0x10, 0xc0, 0xfc, 0xa0, 0x13, 0x10, 0x10, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x32, 0x08, 0x22, 0x08, 0x22, 0x10, 0x23, 0x90, 0x22, 0x60, 0x62, 0x20, 0xae, 0x50, 0x23,
+	0x50, 0x22, 0x88, 0x22, 0x08, 0x32, 0x08, 0x0a, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x40, 0x00, 0x57, 0xf0, 0x4d, 0x48, 0x45, 0x50, 0x45, 0x40, 0xdd, 0x40, 0x45, 0x40,
+	0x4d, 0x40, 0x55, 0x40, 0x47, 0xf8, 0x60, 0x00, 0x10, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x61, 0x20, 0x41, 0x20, 0x55, 0x40, 0x55, 0x80, 0x7f, 0x28, 0x55, 0x28, 0xd5, 0x50, 0x55,
+	0x50, 0x7f, 0x00, 0x55, 0x80, 0x55, 0x40, 0x41, 0x20, 0x61, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00,
+	0x04, 0x00, 0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x08,
+	0x00, 0x10, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02,
+	0x00, 0x40, 0x00, 0x4f, 0xe0, 0x48, 0x20, 0x48, 0x00, 0x7f, 0xf8, 0x48, 0x00, 0x4f, 0xe0, 0x40,
+	0x00, 0xff, 0xc0, 0x00, 0x20, 0x3f, 0x90, 0x00, 0x08, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x04, 0x80,
+	0x04, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x94, 0x00, 0x84, 0x00, 0xff, 0xf0, 0x84, 0x00, 0x94, 0x00,
+	0xa4, 0x00, 0x84, 0x00, 0x04, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x59, 0x80, 0x20, 0x40, 0x24,
+	0x40, 0x3f, 0xf8, 0x24, 0x40, 0xe7, 0xc0, 0x10, 0x40, 0x08, 0x40, 0x04, 0x40, 0x0e, 0x0d, 0x0d,
+	0x00, 0x00, 0x00, 0x00, 0x44, 0x08, 0x44, 0x10, 0x44, 0x20, 0x44, 0x40, 0x45, 0x80, 0xde, 0x00,
+	0x45, 0x80, 0x44, 0x40, 0x44, 0x20, 0x44, 0x10, 0x7f, 0xc8, 0x00, 0x30, 0x00, 0x08, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x40, 0x43, 0x00, 0x42, 0x80, 0x52, 0x00, 0x5a, 0x00, 0x57, 0xf0, 0xda,
+	0x08, 0x52, 0x10, 0x52, 0x00, 0x42, 0x00, 0x7f, 0xc0, 0x00, 0x30, 0x00, 0x08, 0x0e, 0x0d, 0x0d,
+	0x00, 0x00, 0x67, 0x98, 0x08, 0x00, 0xff, 0xf8, 0x08, 0x10, 0xff, 0xf8, 0x08, 0x00, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x57, 0xf8, 0x55, 0x48, 0x55, 0x40, 0xfd, 0x40, 0x55,
+	0x40, 0x57, 0xf8, 0x44, 0x00, 0x0c, 0x00, 0x10, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x2e, 0x80, 0x2a, 0x00, 0x2b, 0xf0, 0x6a, 0x08,
+	0xaa, 0x10, 0x2e, 0x00, 0x20, 0xc0, 0x08, 0x20, 0x10, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x3c, 0x00,
+	0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x00, 0x80, 0x00, 0x40, 0x0f, 0x80, 0x09, 0x00, 0xfe, 0x70, 0xaa,
+	0x10, 0xaa, 0x50, 0xfe, 0x90, 0xaa, 0x10, 0xfa, 0xe0, 0x08, 0x00, 0x0f, 0x40, 0x00, 0x20, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x1b, 0xf8, 0x0a, 0x10, 0xca, 0x10, 0x2a, 0x10,
+	0x1b, 0xf8, 0x08, 0x00, 0x24, 0x00, 0x22, 0x00, 0xff, 0xf0, 0x21, 0x08, 0x21, 0x10, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x10, 0x10, 0x1f, 0x20, 0x10, 0xc0, 0xf3, 0x20, 0x0c,
+	0x10, 0x02, 0x08, 0x68, 0x40, 0x39, 0xc0, 0x2d, 0x78, 0xfb, 0x28, 0x29, 0x20, 0x28, 0xa0, 0x0e,
+	0x09, 0x0c, 0x02, 0x01, 0x3f, 0x00, 0xff, 0xf0, 0x84, 0x20, 0xff, 0xf0, 0x0e, 0x0d, 0x0c, 0x00,
+	0x01, 0x67, 0x98, 0x00, 0x10, 0xff, 0x90, 0x88, 0x90, 0xff, 0x90, 0x00, 0x10, 0x0e, 0x0c, 0x0d,
+	0x01, 0x00, 0x40, 0x20, 0x10, 0x00, 0xff, 0xf0, 0x10, 0x08, 0x10, 0x10, 0x13, 0x00, 0x14, 0x00,
+	0x10, 0x00, 0x7f, 0xe0, 0x44, 0x40, 0x7f, 0xe0, 0x0e, 0x0c, 0x0d, 0x01, 0x00, 0x08, 0x60, 0xff,
+	0xf0, 0x89, 0x08, 0x89, 0x10, 0x89, 0x00, 0xff, 0xc0, 0x00, 0x30, 0x7f, 0xc8, 0x48, 0x80, 0x7f,
+	0xc0, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x08, 0x01, 0x08, 0xf9, 0x48, 0xa9, 0x48,
+	0xaf, 0xf8, 0xa9, 0x48, 0xfb, 0x48, 0x00, 0x88, 0x00, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x80, 0x54, 0x80, 0x55, 0x00, 0x57, 0xf8, 0x55, 0x48, 0xf5, 0x48, 0x5d, 0x48, 0x55,
+	0x48, 0x57, 0xf8, 0x55, 0x00, 0x44, 0x80, 0x04, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x42, 0x08,
+	0x00, 0x80, 0xfc, 0x80, 0xaa, 0xf8, 0xab, 0xa8, 0xaa, 0xa8, 0xaf, 0xa8, 0xaa, 0xa8, 0xaa, 0xf8,
+	0xfa, 0xa0, 0x00, 0x90, 0x0e, 0x09, 0x0d, 0x02, 0x00, 0x0c, 0x00, 0xff, 0xf0, 0x92, 0x08, 0x92,
+	0x10, 0x92, 0x00, 0xff, 0xc0, 0x00, 0x30, 0x00, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x60,
+	0x7f, 0xf0, 0x49, 0x08, 0x49, 0x10, 0x49, 0x00, 0x7f, 0xe0, 0x00, 0x90, 0x20, 0x98, 0xff, 0xa0,
+	0x2a, 0x80, 0xff, 0xb0, 0x20, 0x88, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xff,
+	0xf0, 0x10, 0x08, 0x11, 0x10, 0x12, 0x00, 0x3c, 0xc0, 0x23, 0x00, 0x2c, 0x80, 0x12, 0x40, 0x14,
+	0x20, 0xff, 0xf8, 0x16, 0x00, 0x11, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38,
+	0x7c, 0x88, 0x54, 0x48, 0x57, 0xf0, 0x54, 0x00, 0x54, 0xa0, 0x54, 0x90, 0x7f, 0xf8, 0x12, 0x00,
+	0x14, 0x00, 0xff, 0xf8, 0x16, 0x00, 0x11, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x20,
+	0x08, 0x2f, 0xf8, 0x2a, 0xa8, 0xfa, 0xa8, 0x2a, 0xa8, 0x2f, 0xf8, 0x20, 0x08, 0x12, 0x00, 0x14,
+	0x00, 0xff, 0xf8, 0x16, 0x00, 0x11, 0x80, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x3c, 0xc8, 0x80, 0x10,
+	0x84, 0x10, 0xff, 0xf0, 0x80, 0x10, 0x8f, 0xf0, 0x80, 0x10, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x48,
+	0x88, 0x08, 0x40, 0xff, 0xe0, 0x88, 0x50, 0xaa, 0x40, 0xcc, 0x40, 0x88, 0x40, 0xf8, 0x40, 0x0f,
+	0xc0, 0x08, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x20, 0x40,
+	0x10, 0x80, 0x09, 0x00, 0x06, 0x00, 0xff, 0xf0, 0x00, 0x08, 0x1c, 0x10, 0x13, 0x00, 0x10, 0x80,
+	0x10, 0x40, 0x00, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x44, 0x00, 0x57, 0xf0, 0x55,
+	0x48, 0x55, 0x50, 0xfd, 0x40, 0x55, 0x40, 0x57, 0xf8, 0x44, 0x00, 0x04, 0x00, 0x43, 0x00, 0x88,
+	0xf8, 0x10, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x57, 0xf0, 0x54, 0x48,
+	0xff, 0x90, 0x54, 0x40, 0x54, 0xa0, 0xff, 0x80, 0x54, 0x40, 0x57, 0xf8, 0x14, 0x00, 0x43, 0x00,
+	0x88, 0xf8, 0x10, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x20, 0x08, 0x40,
+	0x08, 0x98, 0x10, 0x06, 0x20, 0x01, 0x40, 0x00, 0x80, 0x01, 0x40, 0x06, 0x20, 0xd8, 0x10, 0x20,
+	0x08, 0x10, 0x08, 0x08, 0x08, 0x0e, 0x0a, 0x0d, 0x02, 0x00, 0x3c, 0x00, 0x3f, 0xf8, 0x22, 0x10,
+	0xa2, 0x10, 0x62, 0x10, 0x22, 0x10, 0x3f, 0xf8, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x08, 0x04, 0x30, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xc0, 0x18, 0x20, 0x04, 0x10, 0x89, 0x08, 0x8a,
+	0x00, 0x7f, 0xf8, 0x4b, 0x00, 0x48, 0xc0, 0x08, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x24, 0x00,
+	0x1f, 0x00, 0x11, 0x00, 0xff, 0xf8, 0x11, 0x00, 0x1f, 0x00, 0x88, 0x80, 0x89, 0x00, 0x7f, 0xf8,
+	0x4a, 0x00, 0x49, 0x00, 0x08, 0x80, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+	0x80, 0x10, 0x40, 0x00, 0x20, 0xff, 0x90, 0x00, 0x08, 0x18, 0x08, 0x04, 0x08, 0x89, 0x00, 0x8a,
+	0x00, 0x7f, 0xf8, 0x4b, 0x00, 0x48, 0xc0, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08,
+	0x7a, 0x48, 0x4a, 0x48, 0x4b, 0xf8, 0x4a, 0x48, 0x7a, 0x48, 0x02, 0x08, 0x89, 0x00, 0x8a, 0x00,
+	0x7f, 0xf8, 0x4b, 0x00, 0x48, 0xc0, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x20, 0x10, 0x00, 0x08, 0x10,
+	0x08, 0x1e, 0x08, 0x11, 0xc8, 0x10, 0x38, 0x70, 0x08, 0x90, 0x08, 0x11, 0xc8, 0x16, 0x08, 0x10,
+	0x08, 0x00, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x48, 0x08, 0x48, 0x28,
+	0x6f, 0xa8, 0x5a, 0xa8, 0x4a, 0xa8, 0xcf, 0xf8, 0x4a, 0xa8, 0x5a, 0xa8, 0x6f, 0xa8, 0x48, 0x28,
+	0x48, 0x08, 0x08, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x75, 0xf8, 0x15, 0x08, 0x15,
+	0xf0, 0xf5, 0x00, 0x17, 0xf0, 0x15, 0x00, 0x75, 0xf8, 0x00, 0x00, 0x2c, 0x40, 0x23, 0x40, 0x60,
+	0xa0, 0xa6, 0x20, 0x28, 0x20, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x28, 0x00, 0x2b, 0xf8,
+	0xfa, 0x90, 0x2a, 0x90, 0xfa, 0x90, 0x2b, 0xf8, 0x28, 0x00, 0x7f, 0xf0, 0x49, 0x08, 0x49, 0x10,
+	0x7f, 0xe0, 0x00, 0x18, 0x0e, 0x0d, 0x0c, 0x00, 0x01, 0x44, 0x08, 0x80, 0x10, 0x8d, 0x10, 0x99,
+	0x10, 0x89, 0x10, 0x8f, 0xf0, 0xc9, 0x10, 0xa9, 0x10, 0x99, 0x10, 0x89, 0x10, 0x80, 0x10, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x00, 0x30, 0x40, 0x00, 0x4f, 0xc0, 0x48, 0x20, 0x48, 0x40, 0xe8, 0x00,
+	0x48, 0x00, 0x4f, 0xf8, 0x48, 0x00, 0xe8, 0x00, 0x48, 0x00, 0x40, 0x00, 0x0e, 0x0d, 0x0d, 0x00,
+	0x00, 0x50, 0x18, 0x42, 0x00, 0x42, 0x08, 0xf2, 0x08, 0x42, 0x08, 0x46, 0x08, 0x4a, 0x08, 0x42,
+	0x08, 0xf3, 0xf8, 0x42, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x02, 0x18,
+	0x3c, 0xe8, 0x20, 0xa8, 0xfa, 0xa8, 0x24, 0xa8, 0x2a, 0xf8, 0x01, 0xa8, 0x28, 0xa8, 0xfe, 0xa8,
+	0x29, 0xe8, 0x2a, 0x08, 0x28, 0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0x00, 0x88, 0x48, 0x7f,
+	0xc8, 0x40, 0x48, 0x4f, 0xc8, 0x00, 0x10, 0x67, 0xa0, 0x54, 0x60, 0x4c, 0x90, 0x00, 0x28, 0x6f,
+	0xf0, 0x88, 0x00, 0x08, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x22, 0x00,
+	0x45, 0xf8, 0x89, 0x10, 0x11, 0x10, 0x21, 0x10, 0x11, 0x10, 0x89, 0x10, 0x45, 0xf8, 0x22, 0x00,
+	0x11, 0x00, 0x01, 0x00, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x0c, 0xc0, 0x10, 0x08, 0x90, 0x48, 0x9f,
+	0x48, 0x95, 0x48, 0x7f, 0xf8, 0x55, 0x48, 0x5f, 0x48, 0x50, 0x48, 0x10, 0x08, 0x0e, 0x0c, 0x0d,
+	0x01, 0x00, 0x0c, 0x80, 0xff, 0xf0, 0x80, 0x08, 0x90, 0x50, 0x92, 0x40, 0x9f, 0xc0, 0x92, 0x40,
+	0x10, 0x40, 0x40, 0x00, 0xbf, 0xf8, 0x0e, 0x0b, 0x0c, 0x01, 0x01, 0x38, 0x00, 0xff, 0xf0, 0x84,
+	0x20, 0xff, 0xf0, 0x00, 0x00, 0xc7, 0x00, 0xa8, 0x80, 0x91, 0x00, 0xff, 0xf0, 0x0e, 0x0d, 0x0d,
+	0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x45, 0x20, 0x69, 0x20, 0x57, 0xf8, 0x69, 0x20, 0xc5, 0x20,
+	0x25, 0x60, 0x14, 0x00, 0x63, 0x80, 0x54, 0x40, 0x48, 0x80, 0x7f, 0xf8, 0x0e, 0x0d, 0x0d, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x30, 0x09, 0x40, 0x19, 0x00, 0x29, 0x00, 0xcf, 0xf8, 0x29, 0x08, 0x19,
+	0x00, 0x09, 0x60, 0x04, 0x10, 0x63, 0x80, 0x54, 0x40, 0x48, 0x80, 0x7f, 0xf8, 0x0e, 0x0d, 0x0c,
+	0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x9f, 0xe0, 0x90, 0x10, 0x92, 0xa0, 0x95, 0x00, 0x90, 0x00,
+	0xff, 0xf0, 0x90, 0x00, 0x92, 0x80, 0x95, 0x00, 0x90, 0x00, 0x9f, 0xf0, 0x80, 0x00, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xa8, 0x00, 0xa1, 0xf8, 0xb5, 0x50, 0xa9, 0x50, 0xa1,
+	0x50, 0xfd, 0x50, 0xa1, 0x50, 0xa9, 0x50, 0xb5, 0x50, 0xa1, 0x50, 0xb0, 0x00, 0x08, 0x00, 0x0e,
+	0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xa3, 0xf8, 0xaa, 0xa8, 0xb2, 0xa8, 0xa2, 0xa8,
+	0xa3, 0xf8, 0xfa, 0x20, 0xa2, 0x40, 0xa2, 0x80, 0xb7, 0xf8, 0xaa, 0x80, 0xa2, 0x40, 0x32, 0x20,
+	0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x30, 0x80, 0xa6, 0xf8, 0xad, 0x48, 0xb5, 0x48, 0xa5,
+	0x48, 0xa6, 0xf8, 0xfa, 0x80, 0xa0, 0x50, 0xa7, 0x50, 0xb5, 0xf0, 0xad, 0x08, 0xa7, 0x78, 0x30,
+	0x08, 0x0e, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x44, 0x00, 0x57, 0xf0, 0x55, 0x48,
+	0x55, 0x50, 0x55, 0x40, 0xfd, 0x40, 0x55, 0x40, 0x57, 0xf8, 0x44, 0x00, 0x04, 0x00, 0x0e, 0x0d,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x08, 0x13, 0x08, 0x30, 0x88, 0x50, 0x48, 0x17,
+	0xf0, 0x10, 0x20, 0xfe, 0x10, 0x11, 0x88, 0x10, 0x40, 0x10, 0x20, 0x10, 0x10, 0x10, 0x08,
 };
 
 #endif
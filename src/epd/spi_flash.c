@@ -99,6 +99,82 @@ int fspi_exit(void)
 }
 
 
+/******************************************************************************/
+/* EPD SPI                                                                    */
+/******************************************************************************/
+
+// 墨水屏与Flash共用SPI控制器。屏只写不读, 只需要把CLK与DO映射到屏的IO上。
+// DI不映射: 6个测试点的板子上, Flash的DI与屏的DC是同一个IO。
+
+int espi_init(int clk, int sdo)
+{
+	SetBits16(CLK_PER_REG, SPI_ENABLE, 1);
+
+	gpio_config(clk, 0x0307, 0);
+	gpio_config(sdo, 0x0306, 0);
+
+	SPI_CTRL0 = 0x0010;
+	fspi_set_bitmode(BIT_8);
+
+	return 0;
+}
+
+
+int espi_exit(int clk, int sdo)
+{
+	SPI_CTRL0 = 0;
+	SetBits16(CLK_PER_REG, SPI_ENABLE, 0);
+
+	gpio_config(clk, 0x0300, 0);
+	gpio_config(sdo, 0x0300, 0);
+	return 0;
+}
+
+
+void espi_write(int data)
+{
+	fspi_trans(data);
+}
+
+
+// 批量写。按32位字发送, 每4字节只等待一次传输完成。
+void espi_write_array(u8 *buf, int len)
+{
+	int i = 0;
+
+	if(len>=4){
+		fspi_set_bitmode(BIT_32);
+		for(; i+4<=len; i+=4){
+			fspi_trans((buf[i]<<24) | (buf[i+1]<<16) | (buf[i+2]<<8) | buf[i+3]);
+		}
+		fspi_set_bitmode(BIT_8);
+	}
+	for(; i<len; i++){
+		fspi_trans(buf[i]);
+	}
+}
+
+
+void espi_fill(int data, int len)
+{
+	int i = 0;
+
+	if(len>=4){
+		int word = data&0xff;
+		word |= word<<8;
+		word |= word<<16;
+		fspi_set_bitmode(BIT_32);
+		for(; i+4<=len; i+=4){
+			fspi_trans(word);
+		}
+		fspi_set_bitmode(BIT_8);
+	}
+	for(; i<len; i++){
+		fspi_trans(data);
+	}
+}
+
+
 /******************************************************************************/
 /* SPI flash                                                                  */
 /******************************************************************************/ 
@@ -44,6 +44,7 @@
 #include "uart.h"
 #include "syscntl.h"
 #include "fpga_helper.h"
+#include "epd.h"
 
 /*
  * GLOBAL VARIABLE DEFINITIONS
@@ -107,6 +108,9 @@ void set_pad_functions(void)
 #endif
 
     //GPIO_ConfigurePin(GPIO_LED_PORT, GPIO_LED_PIN, OUTPUT, PID_GPIO, false);
+
+    // Restore the EPD pads if a refresh is in progress
+    epd_hw_restore();
 }
 
 #if defined (CFG_PRINTF_UART2)
@@ -0,0 +1,113 @@
+// 由tools/fontc.py根据tools/ui_strings.txt生成, 不要手工修改.
+// 字串中是sfont的字模序号, 用draw_glyph_run绘制.
+
+#ifndef __UI_GLYPHS__
+#define __UI_GLYPHS__
+
+// 生成时字库的大小. 字库改变后要重新生成(epd_gui.c中检查).
+#define GR_FONT_SIZE  4623
+
+#ifndef GR_SIZE_ONLY
+
+#define GR_JIEQI_NUM  24
+static const u16 gr_jieqi[24][3] = {
+	{132, 131, GR_END},  // 小寒
+	{125, 131, GR_END},  // 大寒
+	{167, 149, GR_END},  // 立春
+	{182, 158, GR_END},  // 雨水
+	{140, 174, GR_END},  // 惊蛰
+	{149, 111, GR_END},  // 春分
+	{159, 147, GR_END},  // 清明
+	{176, 182, GR_END},  // 谷雨
+	{167, 122, GR_END},  // 立夏
+	{132, 160, GR_END},  // 小满
+	{173, 164, GR_END},  // 芒种
+	{122, 171, GR_END},  // 夏至
+	{132, 150, GR_END},  // 小暑
+	{125, 150, GR_END},  // 大暑
+	{167, 163, GR_END},  // 立秋
+	{121, 150, GR_END},  // 处暑
+	{162, 185, GR_END},  // 白露
+	{163, 111, GR_END},  // 秋分
+	{131, 185, GR_END},  // 寒露
+	{184, 180, GR_END},  // 霜降
+	{167, 110, GR_END},  // 立冬
+	{132, 183, GR_END},  // 小雪
+	{125, 183, GR_END},  // 大雪
+	{110, 171, GR_END},  // 冬至
+};
+
+#define GR_WDAY_NUM  7
+static const u16 gr_wday[7][2] = {
+	{ 95, GR_END},  // 一
+	{101, GR_END},  // 二
+	{ 98, GR_END},  // 三
+	{118, GR_END},  // 四
+	{102, GR_END},  // 五
+	{109, GR_END},  // 六
+	{144, GR_END},  // 日
+};
+
+#define GR_LDAY_LO_NUM  13
+static const u16 gr_lday_lo[13][2] = {
+	{ 95, GR_END},  // 一
+	{101, GR_END},  // 二
+	{ 98, GR_END},  // 三
+	{118, GR_END},  // 四
+	{102, GR_END},  // 五
+	{109, GR_END},  // 六
+	{ 96, GR_END},  // 七
+	{108, GR_END},  // 八
+	{100, GR_END},  // 九
+	{115, GR_END},  // 十
+	{110, GR_END},  // 冬
+	{170, GR_END},  // 腊
+	{156, GR_END},  // 正
+};
+
+#define GR_LDAY_HI_NUM  5
+static const u16 gr_lday_hi[5][2] = {
+	{112, GR_END},  // 初
+	{115, GR_END},  // 十
+	{138, GR_END},  // 廿
+	{101, GR_END},  // 二
+	{ 98, GR_END},  // 三
+};
+
+static const u16 gr_lrun[] = {178, GR_END};  // 闰
+
+static const u16 gr_lmon[] = {151, GR_END};  // 月
+
+#define GR_HDAY_NUM  26
+static const u16 gr_hday[26][5] = {
+	{181, 123, GR_END},  // 除夕
+	{149, 172, GR_END},  // 春节
+	{106, 130, 172, GR_END},  // 元宵节
+	{187, 142, 126, GR_END},  // 龙抬头
+	{169, 116, 172, GR_END},  // 端午节
+	{ 96, 123, 172, GR_END},  // 七夕节
+	{ 99, 163, 172, GR_END},  // 中秋节
+	{177, 179, 172, GR_END},  // 重阳节
+	{170, 108, 172, GR_END},  // 腊八节
+	{106, 145, 172, GR_END},  // 元旦节
+	{139, 104, 172, GR_END},  // 情人节
+	{128, 127, 172, GR_END},  // 妇女节
+	{155, 153, 172, GR_END},  // 植树节
+	{141, 104, 172, GR_END},  // 愚人节
+	{114, 113, 172, GR_END},  // 劳动节
+	{186, 135, 172, GR_END},  // 青年节
+	{157, 103, 172, GR_END},  // 母亲节
+	{105, 168, 172, GR_END},  // 儿童节
+	{161, 103, 172, GR_END},  // 父亲节
+	{143, 133, 172, GR_END},  // 教师节
+	{119, 136, 172, GR_END},  // 国庆节
+	{166, 137, 117, 172, GR_END},  // 程序员节
+	{ 97, 120, 172, GR_END},  // 万圣节
+	{107, 154, 172, GR_END},  // 光棍节
+	{134, 129, 124, GR_END},  // 平安夜
+	{120, 175, 172, GR_END},  // 圣诞节
+};
+
+#endif
+
+#endif
@@ -50,6 +50,11 @@
 
 #include "epd.h"
 
+// 为1时每次刷新都打印传输速度与字库缓存命中率. 调试用, 每分钟都会执行.
+#ifndef EPD_REPORT
+#define EPD_REPORT  0
+#endif
+
 /*
  * GLOBAL VARIABLE DEFINITIONS
  ****************************************************************************************
@@ -59,6 +64,8 @@ ke_msg_id_t timer_used      __SECTION_ZERO("retention_mem_area0"); //@RETENTION
 uint16_t indication_counter __SECTION_ZERO("retention_mem_area0"); //@RETENTION MEMORY
 uint16_t non_db_val_counter __SECTION_ZERO("retention_mem_area0"); //@RETENTION MEMORY
 int adcval;
+// 屏的总线: 0 SPI控制器, 1 GPIO模拟. 由0x93命令切换, 下次刷新时生效.
+static int epd_bus_sel       __SECTION_ZERO("retention_mem_area0"); //@RETENTION MEMORY
 
 
 static void get_holiday(void);
@@ -313,62 +320,54 @@ void clock_print(void)
 
 /****************************************************************************************/
 
-static char *jieqi_name[] = {
-	"小寒", "大寒", "立春", "雨水", "惊蛰", "春分",
-	"清明", "谷雨", "立夏", "小满", "芒种", "夏至",
-	"小暑", "大暑", "立秋", "处暑", "白露", "秋分",
-	"寒露", "霜降", "立冬", "小雪", "大雪", "冬至",
-};
-static char *wday_str[] = {"一", "二", "三", "四", "五", "六", "日"};
-static char *lday_str_lo[] = {"一", "二", "三", "四", "五", "六", "七", "八", "九", "十", "冬", "腊", "正"};
-static char *lday_str_hi[] = {"初", "十", "廿", "二", "三"};
-
-static int epd_wait_state;
-static timer_hnd epd_wait_hnd;
+// 节气, 星期, 农历日期与节日的文字在tools/ui_strings.txt中, 编译为sfont的字模序号.
+#include "ui_glyphs.h"
 
 typedef struct {
-	char *name;
 	uint8_t mon;
 	uint8_t day;
 }HOLIDAY_INFO;
 
+// 节日的名字是gr_hday中相同位置的字串
 HOLIDAY_INFO hday_info[] = {
-	{"除夕",   0xc0|12, 30},
-	{"春节",   0x80| 1,  1},
-	{"元宵节", 0x80| 1, 15},
-	{"龙抬头", 0x80| 2,  2},
-	{"端午节", 0x80| 5,  5},
-	{"七夕节", 0x80| 7,  7},
-	{"中秋节", 0x80| 8, 15},
-	{"重阳节", 0x80| 9,  9},
-	{"腊八节", 0x80|12,  8},
-
-	{"元旦节",       1,  1},
-	{"情人节",       2, 14},
-	{"妇女节",       3,  8},
-	{"植树节",       3, 12},
-	{"愚人节",       4,  1},
-	{"劳动节",       5,  1},
-	{"青年节",       5,  4},
-	{"母亲节",       5, 0x97}, // 5月第二个周日
-	{"儿童节",       6,  1},
-	{"父亲节",       6, 0xa7}, // 6月第三个周日
-	{"教师节",       9, 10},
-	{"国庆节",      10,  1},
-	{"程序员节",    10, 24},
-	{"万圣节",      11,  1},
-	{"光棍节",      11, 11},
-	{"平安夜",      12, 24},
-	{"圣诞节",      12, 25},
-	{"",             0,  0},
+	{0xc0|12, 30},  // 除夕
+	{0x80| 1,  1},  // 春节
+	{0x80| 1, 15},  // 元宵节
+	{0x80| 2,  2},  // 龙抬头
+	{0x80| 5,  5},  // 端午节
+	{0x80| 7,  7},  // 七夕节
+	{0x80| 8, 15},  // 中秋节
+	{0x80| 9,  9},  // 重阳节
+	{0x80|12,  8},  // 腊八节
+
+	{      1,  1},  // 元旦节
+	{      2, 14},  // 情人节
+	{      3,  8},  // 妇女节
+	{      3, 12},  // 植树节
+	{      4,  1},  // 愚人节
+	{      5,  1},  // 劳动节
+	{      5,  4},  // 青年节
+	{      5, 0x97}, // 母亲节: 5月第二个周日
+	{      6,  1},  // 儿童节
+	{      6, 0xa7}, // 父亲节: 6月第三个周日
+	{      9, 10},  // 教师节
+	{     10,  1},  // 国庆节
+	{     10, 24},  // 程序员节
+	{     11,  1},  // 万圣节
+	{     11, 11},  // 光棍节
+	{     12, 24},  // 平安夜
+	{     12, 25},  // 圣诞节
+	{      0,  0},
 };
 
-static char *jieqi_str = "小寒";
-static char *holiday_str = "元旦节";
+// hday_info与gr_hday的个数必须相同
+typedef char hday_info_check[(sizeof(hday_info)/sizeof(hday_info[0])==GR_HDAY_NUM+1)? 1: -1];
 
-static void ldate_str(char *buf)
+static const u16 *jieqi_str = gr_jieqi[0];   // 小寒
+static const u16 *holiday_str = gr_hday[9];  // 元旦节
+
+static void ldate_run(u16 *run)
 {
-	char *lflag = (l_month&0x80)? "闰" : "";
 	int lm = l_month&0x7f;
 	if(lm==0){
 		lm = 12;
@@ -383,19 +382,25 @@ static void ldate_str(char *buf)
 		else if(hi==2)
 			hi = 4;
 	}
-	
-	sprintf(buf, "%s%s月%s%s", lflag, lday_str_lo[lm], lday_str_hi[hi], lday_str_lo[lo]);
+
+	if(l_month&0x80)
+		*run++ = gr_lrun[0];
+	*run++ = gr_lday_lo[lm][0];
+	*run++ = gr_lmon[0];
+	*run++ = gr_lday_hi[hi][0];
+	*run++ = gr_lday_lo[lo][0];
+	*run = GR_END;
 }
 
 
 static void set_holiday(int index)
 {
 	if(holiday_str==NULL){
-		holiday_str = hday_info[index].name;
+		holiday_str = gr_hday[index];
 	}else if(jieqi_str==NULL){
 		// 已经有一个农历节日了，将其转移到节气位置。
 		jieqi_str = holiday_str;
-		holiday_str = hday_info[index].name;
+		holiday_str = gr_hday[index];
 	}else{
 		// printf("OOPS! 节日溢出!\n");
 	}
@@ -410,7 +415,7 @@ void get_holiday(void)
 
 	i = jieqi(year, month, date);
 	if(i>=0){
-		jieqi_str = jieqi_name[i];
+		jieqi_str = gr_jieqi[i];
 	}
 
 	i = 0;
@@ -470,93 +475,200 @@ static uint8_t batt_cal(uint16_t adc_sample)
     return batt_lvl;
 }
 
+// 电池外框, 17x9, 左边是正极
+static const u8 icon_batt[9*3] = {
+	0x3f, 0xff, 0x80,
+	0x20, 0x00, 0x80,
+	0x20, 0x00, 0x80,
+	0xe0, 0x00, 0x80,
+	0xe0, 0x00, 0x80,
+	0xe0, 0x00, 0x80,
+	0x20, 0x00, 0x80,
+	0x20, 0x00, 0x80,
+	0x3f, 0xff, 0x80,
+};
+
+// 蓝牙图标, 5x9
+static const u8 icon_bt[9] = {
+	0x20, 0x30, 0xa8, 0x70, 0x20, 0x70, 0xa8, 0x30, 0x20,
+};
+
 static void draw_batt(int x, int y)
 {
 	int p = batt_cal(adcval);
 	p /= 10;
 
-	draw_rect(x, y-4, x+14, y+4, BLACK);
-	draw_box(x-2, y-1, x-1, y+1, BLACK);
+	draw_bitmap(x-2, y-4, 17, 9, icon_batt, BLACK);
 
 	draw_box(x+12-p, y-2, x+12, y+2, BLACK);
 }
 
 static void draw_bt(int x, int y)
 {
-	int i;
+	draw_bitmap(x-2, y-4, 5, 9, icon_bt, BLACK);
+}
 
-	draw_vline(x, y-4, y+4, BLACK);
-	
-	for(i=0; i<5; i++){
-		draw_pixel(x-2+i, y-2+i, BLACK);
-		draw_pixel(x-2+i, y+2-i, BLACK);
+
+// 刷新期间又要重画时(设置时间, 广播结束, 断开连接, 每分钟的时钟)记下flags,
+// 刷新完成后再画. 没有等待的重画时为0.
+#define DRAW_PENDING  0x100
+static int draw_pending;
+
+
+// 刷新完成(BUSY变低). 由唤醒中断发消息, 在主循环中执行.
+// 屏不断电, RAM中保留这一帧, 下次只需发送改动的部分.
+static void epd_done(void)
+{
+	int flags;
+
+	epd_screen_sync();
+	epd_standby();
+	epd_hw_close();
+
+	if(draw_pending){
+		flags = draw_pending&0xff;
+		draw_pending = 0;
+		clock_draw(flags);
 	}
-	draw_pixel(x+1, y-3, BLACK);
-	draw_pixel(x+1, y+3, BLACK);
 }
 
 
-static void epd_wait_timer(void)
+/****************************************************************************************/
+
+// 屏幕分为几个区域(部件), 内容没变的区域不重画. 日期两行内容一天才变一次,
+// 分条绘制时缓存画好的像素, 每分钟重画时不用再排版解码.
+enum {
+	AREA_BATT,
+	AREA_BT,
+	AREA_TIME,
+	AREA_DATE,
+	AREA_LDATE,
+	AREA_NUM,
+};
+
+// 缓存的范围(屏幕坐标), w为0的不缓存
+static EPD_WIDGET draw_area[AREA_NUM] = {
+	{ 0,  0,   0,  0},  // AREA_BATT
+	{ 0,  0,   0,  0},  // AREA_BT
+	{ 0,  0,   0,  0},  // AREA_TIME
+	{12,  6, 180, 16},  // AREA_DATE
+	{10, 84, 200, 16},  // AREA_LDATE
+};
+
+
+static void draw_area_content(int id, int flags)
 {
-	if(epd_busy()){
-		epd_wait_hnd = app_easy_timer(40, epd_wait_timer);
-	}else{
-		epd_wait_hnd = EASY_TIMER_INVALID_TIMER;
-		epd_cmd1(0x10, 0x01);
-		epd_power(0);
-		epd_hw_close();
-		arch_set_sleep_mode(ARCH_EXT_SLEEP_ON);
+	char tbuf[64];
+	u16 run[8];
+	int x;
+
+	switch(id){
+	case AREA_BATT:
+		// 显示电池电量
+		draw_batt(190, 13);
+		break;
+	case AREA_BT:
+		if(flags&DRAW_BT){
+			// 显示蓝牙图标
+			draw_bt(180, 13);
+		}
+		break;
+	case AREA_TIME:
+		// 使用大字显示时间
+		select_font(1);
+		sprintf(tbuf, "%02d:%02d", hour, minute);
+		draw_text(12, 25, tbuf, BLACK);
+		break;
+	case AREA_DATE:
+		// 显示公历日期
+		sprintf(tbuf, "%4d年%2d月%2d日   星期", year, month+1, date+1);
+		select_font(0);
+		x = draw_text(15, 8, tbuf, BLACK);
+		draw_glyph_run(x, 8, gr_wday[wday], BLACK);
+		break;
+	case AREA_LDATE:
+		// 显示农历日期(不显示年)
+		select_font(0);
+		ldate_run(run);
+		draw_glyph_run(12, 85, run, BLACK);
+		// 显示节气与节假日
+		if(jieqi_str)
+			draw_glyph_run( 98, 85, jieqi_str, BLACK);
+		if(flags&DRAW_BT){
+			draw_text(152, 85, bt_id, BLACK);
+		}else if(holiday_str){
+			draw_glyph_run(152, 85, holiday_str, BLACK);
+		}
+		break;
 	}
 }
 
 
-void clock_draw(int flags)
+static void draw_areas(int flags, int all)
 {
-	char tbuf[64];
+	int key[AREA_NUM];
+	int dkey = (year*12+month)*31+date;
+	int bt = (flags&DRAW_BT)? 1: 0;
 
-	epd_hw_open();
+	key[AREA_BATT]  = batt_cal(adcval)/10;
+	key[AREA_BT]    = bt;
+	key[AREA_TIME]  = hour*60+minute;
+	key[AREA_DATE]  = dkey;
+	key[AREA_LDATE] = dkey*2+bt;
 
-	epd_update_mode(flags&3);
+	epd_widget_update(draw_area, AREA_NUM, key, draw_area_content, flags, all);
+}
 
-	memset(fb_bw, 0xff, scr_h*line_bytes);
-	memset(fb_rr, 0x00, scr_h*line_bytes);
 
-	// 显示电池电量
-	draw_batt(190, 13);
-	if(flags&DRAW_BT){
-		// 显示蓝牙图标
-		draw_bt(180, 13);
+void clock_draw(int flags)
+{
+	int mode = flags&3;
+	RECT sent;
+
+	// 上一次刷新还没有完成. 内容按完成时的状态画, 模式取更彻底的一个(FULL最小).
+	if(epd_busy_pending()){
+		if(draw_pending && (draw_pending&3)<mode)
+			mode = draw_pending&3;
+		draw_pending = DRAW_PENDING | (flags&~3) | mode;
+		return;
 	}
 
-	// 使用大字显示时间
-	select_font(1);
-	sprintf(tbuf, "%02d:%02d", hour, minute);
-	draw_text(12, 25, tbuf, BLACK);
-
-	// 显示公历日期
-	sprintf(tbuf, "%4d年%2d月%2d日   星期%s", year, month+1, date+1, wday_str[wday]);
-	select_font(0);
-	draw_text(15, 8, tbuf, BLACK);
-
-	// 显示农历日期(不显示年)
-	ldate_str(tbuf);
-	draw_text(12, 85, tbuf, BLACK);
-	// 显示节气与节假日
-	if(jieqi_str)
-		draw_text( 98, 85, jieqi_str, BLACK);
-	if(flags&DRAW_BT){
-		draw_text(152, 85, bt_id, BLACK);
-	}else if(holiday_str){
-		draw_text(152, 85, holiday_str, BLACK);
+	draw_areas(flags, mode==UPDATE_FULL);
+
+	// 分条绘制时显示列表放不下, 这一帧不完整, 不发送. 屏上保留上一帧.
+	if(fb_overflow()){
+		rect_clear(&fb_dirty);
+		return;
+	}
+
+	// 与屏上的内容相同(比如蓝牙图标出现又消失), 不用打开屏.
+	if(epd_screen_diff(&fb_dirty)==0 && mode!=UPDATE_FULL){
+		rect_clear(&fb_dirty);
+		return;
 	}
+	sent = fb_dirty;
+	rect_clear(&fb_dirty);
+
+	// 请求的模式是下限, 残影预算用完时升级为fast或full.
+	mode = epd_policy_mode(mode);
+
+	epd_hw_bus((epd_bus_sel)? &epd_bus_gpio : &epd_bus_spi);
+	epd_hw_open();
 
-	// 墨水屏更新显示
+	epd_update_mode(mode);
+
+	// 墨水屏更新显示. 屏RAM还保留着上一帧时只发送改动的行.
 	epd_init();
+	epd_screen_window(&sent);
 	epd_screen_update();
 	epd_update();
-	// 更新时如果深度休眠，会花屏。 这里暂时关闭休眠。
-	arch_set_sleep_mode(ARCH_SLEEP_OFF);
-	epd_wait_hnd = app_easy_timer(40, epd_wait_timer);
+#if EPD_REPORT
+	epd_xfer_report();
+	fstore_report();
+#endif
+	epd_policy_done(&sent, update_mode);
+	// 刷新期间可以休眠, IO配置在唤醒后由epd_hw_restore恢复.
+	epd_busy_notify(epd_done);
 }
 
 
@@ -576,9 +688,28 @@ void user_svc1_long_val_wr_ind_handler(ke_msg_id_t const msgid, struct custs1_va
 		clock_set((uint8_t*)param->value);
 		clock_draw(DRAW_BT|UPDATE_FAST);
 		clock_print();
+	}else if(param->value[0]==0x92){
+		// 清除刷新时间统计
+		epd_stat_clear();
+	}else if(param->value[0]==0x93){
+		// 选择屏的总线: 0 SPI, 1 GPIO. 刷新进行中时屏还打开着, 下次刷新时才切换.
+		epd_bus_sel = (param->length>1 && param->value[1])? 1: 0;
+		printk("EPD bus: %s\n", (epd_bus_sel)? "gpio" : "spi");
 	}
 }
 
+// 读刷新时间统计. 格式见epd_stat.c
+void user_svc1_refresh_stat_read_handler(ke_msg_id_t const msgid, struct custs1_value_req_ind const *param, ke_task_id_t const dest_id, ke_task_id_t const src_id)
+{
+	struct custs1_value_req_rsp *rsp = KE_MSG_ALLOC_DYN(CUSTS1_VALUE_REQ_RSP, src_id, dest_id, custs1_value_req_rsp, DEF_SVC1_REFRESH_STAT_CHAR_LEN);
+	rsp->conidx  = app_env[param->conidx].conidx;
+	rsp->att_idx = param->att_idx;
+	rsp->length  = epd_stat_read(rsp->value, DEF_SVC1_REFRESH_STAT_CHAR_LEN);
+	rsp->status  = ATT_ERR_NO_ERROR;
+
+	KE_MSG_SEND(rsp);
+}
+
 void user_svc1_long_val_att_info_req_handler(ke_msg_id_t const msgid, struct custs1_att_info_req const *param, ke_task_id_t const dest_id, ke_task_id_t const src_id)
 {
     struct custs1_att_info_rsp *rsp = KE_MSG_ALLOC(CUSTS1_ATT_INFO_RSP, src_id, dest_id, custs1_att_info_rsp);
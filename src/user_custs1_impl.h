@@ -219,6 +219,20 @@ void user_svc3_read_non_db_val_handler(ke_msg_id_t const msgid,
                                            ke_task_id_t const dest_id,
                                            ke_task_id_t const src_id);
 
+/**
+ ****************************************************************************************
+ * @brief Refresh statistics read request handler.
+ * @param[in] msgid   Id of the message received.
+ * @param[in] param   Pointer to the parameters of the message.
+ * @param[in] dest_id ID of the receiving task instance.
+ * @param[in] src_id  ID of the sending task instance.
+ ****************************************************************************************
+ */
+void user_svc1_refresh_stat_read_handler(ke_msg_id_t const msgid,
+                                         struct custs1_value_req_ind const *param,
+                                         ke_task_id_t const dest_id,
+                                         ke_task_id_t const src_id);
+
 /// @} APP
 
 #endif // _USER_CUSTS1_IMPL_H_
@@ -181,11 +181,21 @@ void user_app_init(void)
 	adv_state = 0;
 	fspi_config(0x00030605);
 
-	epd_hw_init(0x23200700, 0x05210006, 104, 212, ROTATE_3);  // 2.13黑白屏，6个测试点
-	if(epd_detect()==0){
-		epd_hw_init(0x23111000, 0x07210120, 104, 212, ROTATE_3);  // 2.13黑白屏，5个测试点
-		epd_detect();
+	// 热启动时直接使用保存的配置. 否则按Flash中的出厂信息配置, 没有时再逐个试.
+	if(epd_panel_load()==0){
+		int found = epd_panel_flash();
+		if(found==0){
+			epd_hw_init(0x23200700, 0x05210006, 104, 212, ROTATE_3);  // 2.13黑白屏，6个测试点
+			found = epd_detect();
+		}
+		if(found==0){
+			epd_hw_init(0x23111000, 0x07210120, 104, 212, ROTATE_3);  // 2.13黑白屏，5个测试点
+			found = epd_detect();
+		}
+		if(found)
+			epd_panel_save();
 	}
+	// 探测时用GPIO模拟. 刷新时的总线由clock_draw选择(默认SPI, 见0x93命令).
 
 	selflash(otp_boot);
 
@@ -199,12 +209,12 @@ static void app_clock_timer_cb(void)
 
 	int stat = clock_update(clock_interval);
 	clock_print();
+	epd_policy_tick(clock_interval);
 
+	// 刷新模式由epd_policy按残影预算决定, 这里只请求fly.
 	int flags = UPDATE_FLY;
-	if(stat>=3){
-		flags = DRAW_BT | UPDATE_FULL;
-	}else if(stat>=2){
-		flags = DRAW_BT | UPDATE_FAST;
+	if(stat>=2){
+		flags = DRAW_BT | UPDATE_FLY;
 	}
 
 	if(flags==4){
@@ -394,12 +404,16 @@ void user_catch_rest_hndl(ke_msg_id_t const msgid,
 
         case CUSTS1_VALUE_REQ_IND:
         {
-			/* 读特征值. 什么时候会有这个事件? */
+			/* 读特征值. 只有Database中设置了PERM(RI)的特征值才有这个事件. */
 			printk("CUSTS1_VALUE_REQ_IND!\n");
             struct custs1_value_req_ind const *msg_param = (struct custs1_value_req_ind const *) param;
 
             switch (msg_param->att_idx)
             {
+                case SVC1_IDX_REFRESH_STAT_VAL:
+                    user_svc1_refresh_stat_read_handler(msgid, msg_param, dest_id, src_id);
+                    break;
+
                 default:
                 {
                     // Send Error message
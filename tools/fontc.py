@@ -0,0 +1,613 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# 字库工具(在PC上运行):
+#
+#   检查字库头文件:
+#       python3 tools/fontc.py check src/epd/sfont.h
+#
+#   按编码重排索引(去掉重复的编码), 写回原文件:
+#       python3 tools/fontc.py sort src/epd/sfont.h
+#
+#   把固定的界面文字编译为字模序号(draw_glyph_run使用):
+#       python3 tools/fontc.py strings tools/ui_strings.txt src/ui_glyphs.h
+#
+#   从BDF或TTF(需要Pillow)生成字库, 字模按屏的原生方向预先旋转:
+#       python3 tools/fontc.py build wqy12.bdf -o sfont.h --name sfont --range 20-7e --text tools/ui_strings.txt --rotate 3 --rle
+#       python3 tools/fontc.py build DSEG7.ttf --size 56 -o font56.h --name F_DSEG7_56 --range 30-3a --rotate 3
+#
+#   把已有的字库转为另一个方向(--rotate -1表示不旋转), --rle压缩:
+#       python3 tools/fontc.py rotate src/epd/sfont.h --rotate 3 --rle
+#
+#   生成SPI Flash中的字库(内置字库中没有的字从这里读), 用SmartSnippets写入Flash的0x40000处:
+#       python3 tools/fontc.py pack wqy12.bdf -o font_store.bin --gb2312 --rotate 3 --rle
+#
+# 字库格式(小端):
+#
+#   u16 个数N | 标志              # 低12位是个数. 0x8000: 字模已旋转, 0x3000: 旋转方向(ROTATE_x)
+#                                 # 0x4000: 字模按行压缩
+#   N * {u16 编码, u16 偏移}      # 按编码从小到大排列, 偏移从字库开头算起
+#   字模: u8 adv, bw, bh; s8 bx, by; 然后是位图
+#
+# adv是前进宽度, bw/bh是位图大小, bx/by是位图左上角相对于文字起点(行顶)的偏移,
+# 都是屏幕方向的. 未旋转的位图有bh行, 每行(bw+7)/8字节, 高位在前.
+# 旋转过的位图按原生坐标存放: 原生y从小到大每行一条, 每行从原生x小的一端开始.
+# 旋转90/270度时有bw行, 每行(bh+7)/8字节.
+#
+# 按行压缩时, 位图前面是重复标志, 每行1位(高位在前, 共(行数+7)/8字节), 为1表示
+# 这一行与上一行相同, 不再存放. 后面只存放不重复的行. 绘制时逐行移动指针即可,
+# 不用解出整个字模. 数码管字体的笔画大多是相同的行, 压缩效果很好.
+#
+# epd_gui.c的find_font要求索引有序: 开头编码连续的一段(一般是ASCII)直接定位,
+# 其余的二分查找. 新加字模之后要运行一次sort, 并重新生成strings.
+#
+# strings的输入格式(#之后是注释):
+#
+#   font  ../src/epd/sfont.h          # 字库, 路径相对于这个文件
+#   run   gr_yue  月                  # 一个字串: const u16 gr_yue[]
+#   table gr_wday 一 二 三 ...        # 一组字串: const u16 gr_wday[N][最长+1]
+#
+# 每个字串是字模在索引中的序号, 以GR_END结束.
+#
+# Flash字库的格式(小端, 见epd_font.c):
+#
+#   u32 "FSTR"
+#   u16 标志                      # 同字库头的高4位
+#   u16 个数N
+#   u16 最大的字模字节数          # 不能超过epd_font.c中缓存的大小FC_DATA
+#   u16 保留
+#   u32 总长度
+#   (N+1) * {u16 编码, u24 偏移}  # 按编码排列, 偏移从开头算起. 最后一项编码为0xffff, 偏移是结尾
+#   字模: 与字库中的相同
+
+import os
+import re
+import sys
+import argparse
+
+
+FONT_ROTATED = 0x8000
+FONT_RLE     = 0x4000
+
+STORE_MAGIC  = 0x52545346   # "FSTR"
+STORE_HEAD   = 16
+STORE_MAX    = 0x40000      # 512KB的Flash, 0x40000之后
+STORE_GLYPH  = 36
+
+
+# 屏幕方向的位图坐标(c, r)在旋转rot之后的原生位图中的位置(i, j), 以及原生位图的大小
+def native_pos(rot, c, r, w, h):
+	if rot==1:
+		return h-1-r, c
+	if rot==2:
+		return w-1-c, h-1-r
+	if rot==3:
+		return r, w-1-c
+	return c, r
+
+
+# native_pos的逆变换
+def glyph_pos(rot, i, j, w, h):
+	if rot==1:
+		return j, h-1-i
+	if rot==2:
+		return w-1-i, h-1-j
+	if rot==3:
+		return w-1-j, i
+	return i, j
+
+
+def native_size(rot, w, h):
+	return (h, w) if rot&1 else (w, h)
+
+
+class Glyph:
+	def __init__(self, ucs, adv, w, h, bx, by, rows):
+		self.ucs = ucs
+		self.adv = adv
+		self.w = w
+		self.h = h
+		self.bx = bx
+		self.by = by
+		self.rows = rows    # 屏幕方向, rows[r][c]为0或1
+
+	# 按rot(-1表示不旋转)编码为字库中的字节. rle: 按行压缩
+	def encode(self, rot, rle=False):
+		r0 = max(rot, 0)
+		nw, nh = native_size(r0, self.w, self.h)
+		bits = [[0]*nw for j in range(nh)]
+		for r in range(self.h):
+			for c in range(self.w):
+				if self.rows[r][c]:
+					i, j = native_pos(r0, c, r, self.w, self.h)
+					bits[j][i] = 1
+		rows = []
+		for row in bits:
+			line = []
+			for k in range(0, nw, 8):
+				v = 0
+				for i in range(8):
+					v = (v<<1) | (row[k+i] if k+i<nw else 0)
+				line.append(v)
+			rows.append(line)
+
+		data = [self.adv, self.w, self.h, self.bx&0xff, self.by&0xff]
+		if rle:
+			rep = [0]*((nh+7)//8)
+			for j in range(1, nh):
+				if rows[j]==rows[j-1]:
+					rep[j>>3] |= 0x80>>(j&7)
+			data += rep
+			for j in range(nh):
+				if j==0 or rows[j]!=rows[j-1]:
+					data += rows[j]
+		else:
+			for line in rows:
+				data += line
+		return data
+
+	@staticmethod
+	def decode(ucs, data, rot, rle=False):
+		adv, w, h = data[0], data[1], data[2]
+		bx = (data[3]^0x80)-0x80
+		by = (data[4]^0x80)-0x80
+		r0 = max(rot, 0)
+		nw, nh = native_size(r0, w, h)
+		lsize = (nw+7)//8
+		pos = 5
+		rep = None
+		if rle:
+			rep = data[5:5+(nh+7)//8]
+			pos += len(rep)
+		rows = [[0]*w for r in range(h)]
+		for j in range(nh):
+			if j and not (rep and rep[j>>3] & (0x80>>(j&7))):
+				pos += lsize
+			for i in range(nw):
+				if data[pos+(i>>3)] & (0x80>>(i&7)):
+					c, r = glyph_pos(r0, i, j, w, h)
+					rows[r][c] = 1
+		return Glyph(ucs, adv, w, h, bx, by, rows)
+
+
+class Font:
+	def __init__(self, name, data):
+		self.name = name
+		self.data = list(data)
+
+	def header(self):
+		return self.data[0] | (self.data[1]<<8)
+
+	def count(self):
+		return self.header() & 0x0fff
+
+	# 字模旋转的方向, -1表示未旋转
+	def rotation(self):
+		h = self.header()
+		return (h>>12)&3 if h&FONT_ROTATED else -1
+
+	def index(self):
+		d = self.data
+		return [(d[2+i*4] | (d[3+i*4]<<8), d[4+i*4] | (d[5+i*4]<<8)) for i in range(self.count())]
+
+	# 索引开头编码连续的个数
+	def direct(self):
+		idx = self.index()
+		n = 1 if idx else 0
+		while n<len(idx) and idx[n][0]==idx[0][0]+n:
+			n += 1
+		return n
+
+	def rle(self):
+		return (self.header() & FONT_RLE)!=0
+
+	def glyph_size(self, offset):
+		d = self.data
+		w, h = d[offset+1], d[offset+2]
+		nw, nh = native_size(max(self.rotation(), 0), w, h)
+		if not self.rle():
+			return 5 + (nw+7)//8*nh
+		rep = d[offset+5:offset+5+(nh+7)//8]
+		uniq = nh - sum(bin(v).count("1") for v in rep)
+		return 5 + len(rep) + (nw+7)//8*uniq
+
+	def glyphs(self):
+		rot = self.rotation()
+		return [Glyph.decode(ucs, self.data[off:off+self.glyph_size(off)], rot, self.rle()) for ucs, off in self.index()]
+
+	def check(self):
+		err = []
+		idx = self.index()
+		end = 2 + len(idx)*4
+		for i, (ucs, off) in enumerate(idx):
+			if i and idx[i-1][0]>=ucs:
+				err.append("index %d: %04x after %04x" % (i, ucs, idx[i-1][0]))
+			if off<end or off+5>len(self.data) or off+self.glyph_size(off)>len(self.data):
+				err.append("%04x: bad offset %04x" % (ucs, off))
+		return err
+
+	# 按编码排序(去掉重复的编码), 字模按rot编码. rot/rle为None时保持原来的格式.
+	def build(self, glyphs, rot=None, rle=None):
+		if rot is None:
+			rot = self.rotation()
+		if rle is None:
+			rle = self.rle()
+		uniq = {}
+		for g in glyphs:
+			uniq.setdefault(g.ucs, g)
+		glyphs = [uniq[k] for k in sorted(uniq)]
+		if len(glyphs)>0x0fff:
+			raise ValueError("%s: too many glyphs" % self.name)
+
+		head = len(glyphs)
+		if rot>=0:
+			head |= FONT_ROTATED | (rot<<12)
+		if rle:
+			head |= FONT_RLE
+		data = [head&0xff, head>>8]
+		body = []
+		off = 2 + len(glyphs)*4
+		for g in glyphs:
+			enc = g.encode(rot, rle)
+			data += [g.ucs&0xff, g.ucs>>8, (off+len(body))&0xff, (off+len(body))>>8]
+			body += enc
+		data += body
+		if len(data)>0xffff:
+			raise ValueError("%s: too large for 16-bit offsets" % self.name)
+		self.data = data
+
+	def sort(self):
+		self.build(self.glyphs())
+
+
+##############################################################################
+
+# BDF: 只用到每个字的ENCODING, DWIDTH, BBX与BITMAP
+def read_bdf(path, chars):
+	glyphs = []
+	ascent = None
+	g = None
+	bitmap = None
+	for line in open(path, encoding="latin-1"):
+		w = line.split()
+		if not w:
+			continue
+		if w[0] == "FONT_ASCENT":
+			ascent = int(w[1])
+		elif w[0] == "STARTCHAR":
+			g = {"ucs": -1, "adv": 0}
+		elif w[0] == "ENCODING":
+			g["ucs"] = int(w[1])
+		elif w[0] == "DWIDTH":
+			g["adv"] = int(w[1])
+		elif w[0] == "BBX":
+			g["bbx"] = [int(v) for v in w[1:5]]
+		elif w[0] == "BITMAP":
+			bitmap = []
+		elif w[0] == "ENDCHAR":
+			if g["ucs"] in chars:
+				bw, bh, xoff, yoff = g["bbx"]
+				rows = []
+				for hexrow in bitmap:
+					v = int(hexrow, 16)
+					nbits = len(hexrow)*4
+					rows.append([(v>>(nbits-1-c))&1 for c in range(bw)])
+				glyphs.append((g, rows))
+			g = None
+			bitmap = None
+		elif bitmap is not None:
+			bitmap.append(w[0])
+	if ascent is None:
+		sys.exit("%s: no FONT_ASCENT" % path)
+
+	out = []
+	for g, rows in glyphs:
+		bw, bh, xoff, yoff = g["bbx"]
+		out.append(Glyph(g["ucs"], g["adv"], bw, bh, xoff, ascent-(yoff+bh), rows))
+	return out
+
+
+# TTF/OTF: 用Pillow按size像素渲染
+def read_ttf(path, size, chars):
+	try:
+		from PIL import Image, ImageDraw, ImageFont
+	except ImportError:
+		sys.exit("TTF fonts need Pillow (pip install pillow)")
+	font = ImageFont.truetype(path, size)
+	out = []
+	for ucs in sorted(chars):
+		ch = chr(ucs)
+		l, t, r, b = font.getbbox(ch, anchor="la")
+		adv = int(round(font.getlength(ch)))
+		w, h = max(r-l, 1), max(b-t, 1)
+		img = Image.new("1", (w, h), 0)
+		ImageDraw.Draw(img).text((-l, -t), ch, font=font, fill=1, anchor="la")
+		rows = [[1 if img.getpixel((c, r)) else 0 for c in range(w)] for r in range(h)]
+		out.append(Glyph(ucs, adv, w, h, l, t, rows))
+	return out
+
+
+def char_set(ranges, texts, gb2312=False):
+	chars = set()
+	if gb2312:
+		for hi in range(0xa1, 0xf8):
+			for lo in range(0xa1, 0xff):
+				try:
+					chars.add(ord(bytes([hi, lo]).decode("gb2312")))
+				except UnicodeDecodeError:
+					pass
+	for rg in ranges:
+		a, _, b = rg.partition("-")
+		chars.update(range(int(a, 16), int(b or a, 16)+1))
+	for path in texts:
+		for line in open(path, encoding="utf-8"):
+			line = line.split("#")[0]
+			chars.update(ord(ch) for ch in line if ord(ch)>0x7f)
+	return chars
+
+
+##############################################################################
+
+def parse_strings(path):
+	font = None
+	items = []
+	for ln, line in enumerate(open(path, encoding="utf-8"), 1):
+		line = line.split("#")[0].split()
+		if not line:
+			continue
+		if line[0] == "font" and len(line) == 2:
+			font = os.path.join(os.path.dirname(path), line[1])
+		elif line[0] in ("run", "table") and len(line) >= 3:
+			if line[0] == "run" and len(line) != 3:
+				sys.exit("%s:%d: run takes one string" % (path, ln))
+			items.append((line[0], line[1], line[2:]))
+		else:
+			sys.exit("%s:%d: syntax error" % (path, ln))
+	if font is None:
+		sys.exit("%s: no font" % path)
+	return font, items
+
+
+def emit_strings(spec, font_path, font, items):
+	pos = dict((ucs, i) for i, (ucs, off) in enumerate(font.index()))
+	err = []
+
+	def run(text):
+		r = []
+		for ch in text:
+			if ord(ch) not in pos:
+				err.append("'%s' (%04x) not in %s" % (ch, ord(ch), font.name))
+				r.append(0)
+			else:
+				r.append(pos[ord(ch)])
+		return r
+
+	out = []
+	out.append("// 由tools/fontc.py根据%s生成, 不要手工修改." % spec.replace("\\", "/"))
+	out.append("// 字串中是%s的字模序号, 用draw_glyph_run绘制." % font.name)
+	out.append("")
+	out.append("#ifndef __UI_GLYPHS__")
+	out.append("#define __UI_GLYPHS__")
+	out.append("")
+	out.append("// 生成时字库的大小. 字库改变后要重新生成(epd_gui.c中检查).")
+	out.append("#define GR_FONT_SIZE  %d" % len(font.data))
+	out.append("")
+	out.append("#ifndef GR_SIZE_ONLY")
+	out.append("")
+	for kind, name, texts in items:
+		runs = [run(t) for t in texts]
+		if kind == "run":
+			out.append("static const u16 %s[] = {%s};  // %s" % (
+				name, ", ".join(["%d" % g for g in runs[0]] + ["GR_END"]), texts[0]))
+		else:
+			width = max(len(r) for r in runs)+1
+			out.append("#define %s_NUM  %d" % (name.upper(), len(runs)))
+			out.append("static const u16 %s[%d][%d] = {" % (name, len(runs), width))
+			for t, r in zip(texts, runs):
+				out.append("\t{%s},  // %s" % (", ".join(["%3d" % g for g in r] + ["GR_END"]), t))
+			out.append("};")
+		out.append("")
+	out.append("#endif")
+	out.append("")
+	out.append("#endif")
+	return "\n".join(out) + "\n", err
+
+
+# Flash字库. 返回(数据, 最大的字模字节数)
+def pack_store(glyphs, rot, rle):
+	uniq = {}
+	for g in glyphs:
+		uniq.setdefault(g.ucs, g)
+	glyphs = [uniq[k] for k in sorted(uniq)]
+	if glyphs and glyphs[-1].ucs>=0xffff:
+		raise ValueError("code 0xffff is reserved")
+
+	flags = 0
+	if rot>=0:
+		flags |= FONT_ROTATED | (rot<<12)
+	if rle:
+		flags |= FONT_RLE
+
+	index = []
+	body = []
+	off = STORE_HEAD + (len(glyphs)+1)*5
+	gmax = 0
+	for g in glyphs:
+		enc = g.encode(rot, rle)
+		index.append((g.ucs, off+len(body)))
+		body += enc
+		gmax = max(gmax, len(enc))
+	index.append((0xffff, off+len(body)))
+	size = off+len(body)
+
+	data = []
+	for v, n in ((STORE_MAGIC, 4), (flags, 2), (len(glyphs), 2), (gmax, 2), (0, 2), (size, 4)):
+		data += [(v>>(i*8))&0xff for i in range(n)]
+	for ucs, o in index:
+		data += [ucs&0xff, ucs>>8, o&0xff, (o>>8)&0xff, o>>16]
+	data += body
+	return bytes(data), gmax
+
+
+##############################################################################
+
+def read_header(path):
+	text = open(path, encoding="utf-8").read()
+	m = re.search(r"unsigned\s+char\s+(\w+)\s*\[\]\s*[^=]*=\s*\{(.*?)\};", text, re.S)
+	if m is None:
+		sys.exit("%s: no font array" % path)
+	data = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", m.group(2))]
+	return Font(m.group(1), data)
+
+
+def write_header(path, font):
+	out = []
+	guard = "__%s__" % font.name
+	out.append("#ifndef %s" % guard)
+	out.append("#define %s" % guard)
+	out.append("")
+	out.append("#define %s_size  %d" % (font.name, len(font.data)))
+	out.append("static const unsigned char %s[] __attribute__((aligned(4))) = {" % font.name)
+	for i in range(0, len(font.data), 16):
+		out.append("\t" + " ".join("0x%02x," % v for v in font.data[i:i+16]))
+	out.append("};")
+	out.append("")
+	out.append("#endif")
+	open(path, "w", encoding="utf-8").write("\n".join(out) + "\n")
+
+
+def report(path, font):
+	idx = font.index()
+	first = idx[0][0] if idx else 0
+	n = font.direct()
+	rot = font.rotation()
+	print("%s: %s, %d glyphs, %d bytes, direct %04x-%04x (%d), %s%s" % (
+		path, font.name, len(idx), len(font.data), first, first+n-1, n,
+		"rotated %d" % rot if rot>=0 else "not rotated", ", rle" if font.rle() else ""))
+
+
+##############################################################################
+
+# build/pack的输入: BDF, TTF或已有的字库头文件
+def read_glyphs(args):
+	chars = char_set(args.range, args.text, getattr(args, "gb2312", False))
+	if args.src.lower().endswith(".h"):
+		glyphs = read_header(args.src).glyphs()
+		if chars:
+			glyphs = [g for g in glyphs if g.ucs in chars]
+		return glyphs
+	if not chars:
+		sys.exit("no characters, use --range or --text")
+	if args.src.lower().endswith(".bdf"):
+		glyphs = read_bdf(args.src, chars)
+	else:
+		if not args.size:
+			sys.exit("TTF fonts need --size")
+		glyphs = read_ttf(args.src, args.size, chars)
+	missing = chars - set(g.ucs for g in glyphs)
+	if missing:
+		print("WARNING not in font: %d characters" % len(missing) if len(missing)>32 else
+			"WARNING not in font: " + " ".join("%04x" % c for c in sorted(missing)))
+	return glyphs
+
+
+def main():
+	ap = argparse.ArgumentParser(description="font table tool")
+	sub = ap.add_subparsers(dest="cmd")
+
+	p = sub.add_parser("check", help="validate a font header")
+	p.add_argument("file", nargs="+")
+
+	p = sub.add_parser("sort", help="sort the glyph index of a font header in place")
+	p.add_argument("file", nargs="+")
+
+	p = sub.add_parser("build", help="build a font header from a BDF or TTF font")
+	p.add_argument("src")
+	p.add_argument("-o", dest="out", required=True)
+	p.add_argument("--name", required=True, help="C array name")
+	p.add_argument("--size", type=int, help="pixel size (TTF only)")
+	p.add_argument("--range", action="append", default=[], help="hex code range, e.g. 20-7e")
+	p.add_argument("--text", action="append", default=[], help="add all non-ASCII characters of a text file")
+	p.add_argument("--rotate", type=int, default=-1, choices=[-1, 0, 1, 2, 3], help="bake glyphs for ROTATE_x (-1: none)")
+	p.add_argument("--rle", action="store_true", help="store repeated glyph rows once")
+
+	p = sub.add_parser("rotate", help="re-encode a font header for another rotation, in place")
+	p.add_argument("file", nargs="+")
+	p.add_argument("--rotate", type=int, required=True, choices=[-1, 0, 1, 2, 3])
+	p.add_argument("--rle", action="store_true", help="store repeated glyph rows once")
+
+	p = sub.add_parser("pack", help="build the SPI flash font store from a BDF, TTF or font header")
+	p.add_argument("src")
+	p.add_argument("-o", dest="out", required=True)
+	p.add_argument("--size", type=int, help="pixel size (TTF only)")
+	p.add_argument("--range", action="append", default=[], help="hex code range, e.g. 20-7e")
+	p.add_argument("--text", action="append", default=[], help="add all non-ASCII characters of a text file")
+	p.add_argument("--gb2312", action="store_true", help="add all characters of GB2312")
+	p.add_argument("--rotate", type=int, default=-1, choices=[-1, 0, 1, 2, 3], help="bake glyphs for ROTATE_x (-1: none)")
+	p.add_argument("--rle", action="store_true", help="store repeated glyph rows once")
+	p.add_argument("--max", type=lambda v: int(v, 0), default=STORE_MAX, help="flash space in bytes (default 0x40000)")
+
+	p = sub.add_parser("strings", help="compile fixed UI strings into glyph runs")
+	p.add_argument("spec")
+	p.add_argument("out")
+
+	args = ap.parse_args()
+
+	if args.cmd == "check":
+		fail = 0
+		for path in args.file:
+			font = read_header(path)
+			report(path, font)
+			for e in font.check():
+				print("    ERROR", e)
+				fail = 1
+		sys.exit(fail)
+
+	elif args.cmd == "sort":
+		for path in args.file:
+			font = read_header(path)
+			font.sort()
+			write_header(path, font)
+			report(path, font)
+
+	elif args.cmd == "build":
+		glyphs = read_glyphs(args)
+		font = Font(args.name, [0, 0])
+		font.build(glyphs, args.rotate, args.rle)
+		write_header(args.out, font)
+		report(args.out, font)
+
+	elif args.cmd == "pack":
+		data, gmax = pack_store(read_glyphs(args), args.rotate, args.rle)
+		print("%s: %d glyphs, %d bytes, largest glyph %d bytes" % (
+			args.out, (data[6] | (data[7]<<8)), len(data), gmax))
+		if len(data)>args.max:
+			sys.exit("ERROR larger than 0x%x bytes" % args.max)
+		if gmax>STORE_GLYPH:
+			sys.exit("ERROR glyphs larger than the %d-byte cache slot" % STORE_GLYPH)
+		open(args.out, "wb").write(data)
+
+	elif args.cmd == "rotate":
+		for path in args.file:
+			font = read_header(path)
+			font.build(font.glyphs(), args.rotate, args.rle)
+			write_header(path, font)
+			report(path, font)
+
+	elif args.cmd == "strings":
+		font_path, items = parse_strings(args.spec)
+		font = read_header(font_path)
+		text, err = emit_strings(args.spec, font_path, font, items)
+		for e in err:
+			print("ERROR", e)
+		if err:
+			sys.exit(1)
+		open(args.out, "w", encoding="utf-8").write(text)
+		print("%s: %d items from %s" % (args.out, len(items), font.name))
+
+	else:
+		ap.print_help()
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,409 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# 墨水屏LUT工具(在PC上运行):
+#
+#   检查epd.c中的LUT表, 并估算刷新时间:
+#       python3 tools/lutc.py check src/epd/epd.c [--lines 212] [--max lut_fly_70=1000 ...]
+#
+#   把epd.c中的一个LUT表转为波形描述:
+#       python3 tools/lutc.py dump src/epd/epd.c lut_fast_70 > fast.wave
+#
+#   把波形描述编译为C表(格式与epd.c相同):
+#       python3 tools/lutc.py compile fast.wave
+#
+# 波形描述格式(#之后是注释):
+#
+#   format 70                       # 70, 100或30
+#   name   lut_fast_70
+#   #      TPA TPB TPC TPD RP  LUT0 LUT1 LUT2 LUT3 LUT4
+#   group    3   3   0   0  2  LH00 0H00 LH00 0H00 0000
+#   ...                         # 每个Group一行, 最多7/10行, 不足的补0
+#   volt   VGH=0x15 VSH1=0x41 VSH2=0xa8 VSL=0x32        # 100格式还有VCOM
+#   frame  FR1=0x30 FR2=0x0a
+#
+# LUTn的4个字符是相位A-D的电压: 0=VSS H=VSH1 L=VSL h=VSH2.
+#
+# 30格式(IL3895/SSD1673A)是20个相位, 每个相位一个长度与4种转换的电压, 没有电压与帧
+# 设置(由init_head_3895设置, 见FR_30):
+#
+#   format 30
+#   name   lut_fly_30
+#   #      TP  VS
+#   phase  15  0HL0                 # 最多20行, 不足的补0. TP为0-15
+#
+# VS的4个字符依次是字节的bit7-6, 5-4, 3-2, 1-0: 0=VSS H=VSH L=VSL, 不能用h.
+#
+# 刷新时间 = sum((TPA+TPB+TPC+TPD) * (RP+1)) * 帧周期      (30格式为sum(TP) * 帧周期)
+# 帧周期   = (Gate行数 + FR1的dummy行数) * FR2的Gate行时间
+# Gate行时间按SSD1673/SSD1675系列0x3b的A[3:0]取值, 见TGATE_US. 其它控制器可用--tgate指定.
+
+import re
+import sys
+import argparse
+
+
+TGATE_US = [30, 34, 38, 40, 44, 46, 52, 56, 62, 68, 78, 88, 104, 110, 140, 200]
+
+VS_CHR = "0HLh"
+
+FORMATS = {
+	70:  {"phases": 7,  "array": 80,  "tail": ["VGH", "VSH1", "VSH2", "VSL", "FR1", "FR2"]},
+	100: {"phases": 10, "array": 112, "tail": ["VGH", "VSH1", "VSH2", "VSL", "VCOM", "FR1", "FR2"]},
+	30:  {"phases": 20, "array": 30,  "tail": []},
+}
+
+# 30格式的帧设置不在LUT中, 取epd.c中init_head_3895的0x3a/0x3b
+FR_30 = {"FR1": 0x1a, "FR2": 0x08}
+
+
+class Lut:
+	def __init__(self, fmt, name):
+		self.fmt = fmt
+		self.name = name
+		n = FORMATS[fmt]["phases"]
+		self.vs = [[0]*n for i in range(5)]    # vs[lut][group]
+		self.tp = [[0, 0, 0, 0, 0] for i in range(n)]  # TPA TPB TPC TPD RP
+		self.tail = dict((k, 0) for k in FORMATS[fmt]["tail"])
+
+	def size(self):
+		return self.fmt + len(self.tail)
+
+	@staticmethod
+	def new(fmt, name):
+		return Lut30(name) if fmt == 30 else Lut(fmt, name)
+
+	@staticmethod
+	def from_bytes(fmt, name, data):
+		if fmt == 30:
+			return Lut30.from_bytes(name, data)
+		lut = Lut(fmt, name)
+		n = FORMATS[fmt]["phases"]
+		if len(data) < lut.size():
+			raise ValueError("%s: %d bytes, need %d" % (name, len(data), lut.size()))
+		for i in range(5):
+			lut.vs[i] = list(data[i*n:(i+1)*n])
+		for g in range(n):
+			lut.tp[g] = list(data[5*n+g*5:5*n+g*5+5])
+		tail = data[10*n:]
+		for i, k in enumerate(FORMATS[fmt]["tail"]):
+			lut.tail[k] = tail[i]
+		return lut
+
+	def frames(self):
+		return sum(sum(g[0:4])*(g[4]+1) for g in self.tp)
+
+	def frame_us(self, lines, tgate=None):
+		if tgate is None:
+			tgate = TGATE_US[self.tail["FR2"] & 0x0f]
+		return (lines + (self.tail["FR1"] & 0x7f)) * tgate
+
+	def duration_ms(self, lines, tgate=None):
+		return self.frames() * self.frame_us(lines, tgate) / 1000.0
+
+	# 返回(错误, 警告)
+	def check(self):
+		err = []
+		warn = []
+		for k, v in self.tail.items():
+			if v < 0 or v > 255:
+				err.append("%s out of range: %d" % (k, v))
+		for g, t in enumerate(self.tp):
+			for v in t:
+				if v < 0 or v > 255:
+					err.append("Group%d: value out of range: %d" % (g, v))
+			if sum(t[0:4]) == 0:
+				# 没有帧的Group中不应该有电压
+				for l in range(5):
+					if self.vs[l][g]:
+						err.append("LUT%d RP%d: voltage 0x%02x in empty Group%d" % (l, g, self.vs[l][g], g))
+			else:
+				for p in range(4):
+					if t[p] == 0:
+						continue
+					if all(((self.vs[l][g] >> (6-p*2)) & 3) == 0 for l in range(5)):
+						warn.append("Group%d phase %s: %d idle frames (all LUTs at VSS)" % (g, "ABCD"[p], t[p]))
+		return err, warn
+
+
+# IL3895/SSD1673A: VS[0-19]每个相位一个字节, TP[0-19]每个4位, 两个一字节(低4位在前).
+class Lut30(Lut):
+	def __init__(self, name):
+		self.fmt = 30
+		self.name = name
+		self.vs = [0]*20
+		self.tp = [0]*20
+		self.tail = dict(FR_30)
+
+	def size(self):
+		return 30
+
+	@staticmethod
+	def from_bytes(name, data):
+		lut = Lut30(name)
+		if len(data) < 30:
+			raise ValueError("%s: %d bytes, need 30" % (name, len(data)))
+		lut.vs = list(data[0:20])
+		for i in range(10):
+			lut.tp[i*2] = data[20+i] & 0x0f
+			lut.tp[i*2+1] = data[20+i] >> 4
+		return lut
+
+	def to_bytes(self):
+		return self.vs + [(self.tp[i*2] & 0x0f) | (self.tp[i*2+1] << 4) for i in range(10)]
+
+	def frames(self):
+		return sum(self.tp)
+
+	def check(self):
+		err = []
+		warn = []
+		for p in range(20):
+			if self.tp[p] < 0 or self.tp[p] > 15:
+				err.append("TP%d out of range: %d" % (p, self.tp[p]))
+			if self.vs[p] < 0 or self.vs[p] > 255:
+				err.append("VS%d out of range: %d" % (p, self.vs[p]))
+				continue
+			if any(((self.vs[p] >> (6-t*2)) & 3) == 3 for t in range(4)):
+				err.append("VS%d: 0x%02x uses the reserved voltage 11" % (p, self.vs[p]))
+			if self.tp[p] == 0 and self.vs[p]:
+				err.append("VS%d: voltage 0x%02x in empty phase" % (p, self.vs[p]))
+			elif self.tp[p] and self.vs[p] == 0:
+				warn.append("phase %d: %d idle frames (all at VSS)" % (p, self.tp[p]))
+		return err, warn
+
+
+##############################################################################
+
+def c_tables(path):
+	text = open(path, encoding="utf-8").read()
+	text = re.sub(r"//[^\n]*", "", text)
+	tables = {}
+	for m in re.finditer(r"u8\s+(lut_\w+)\s*\[(\d+)\]\s*=\s*\{(.*?)\};", text, re.S):
+		name, size, body = m.group(1), int(m.group(2)), m.group(3)
+		data = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+		tables[name] = (size, data)
+	return tables
+
+
+def c_lut(path, name):
+	size, data = c_tables(path)[name]
+	fmt = lut_format(name, size)
+	return Lut.from_bytes(fmt, name, data)
+
+
+def lut_format(name, size):
+	m = re.search(r"_(\d+)$", name)
+	if m and int(m.group(1)) in FORMATS:
+		return int(m.group(1))
+	for fmt, f in FORMATS.items():
+		if f["array"] == size:
+			return fmt
+	return None
+
+
+def vs_str(v):
+	return "".join(VS_CHR[(v >> (6-p*2)) & 3] for p in range(4))
+
+
+def vs_val(s):
+	if len(s) != 4 or any(c not in VS_CHR for c in s):
+		raise ValueError("bad voltage string: " + s)
+	v = 0
+	for c in s:
+		v = (v << 2) | VS_CHR.index(c)
+	return v
+
+
+##############################################################################
+
+def parse_wave(path):
+	lut = None
+	fmt = 70
+	name = "lut_new"
+	groups = []
+	kv = {}
+	for ln, line in enumerate(open(path, encoding="utf-8"), 1):
+		line = line.split("#")[0].split()
+		if not line:
+			continue
+		try:
+			key = line[0]
+			if key == "format":
+				fmt = int(line[1])
+				if fmt not in FORMATS:
+					raise ValueError("unknown format %d" % fmt)
+			elif key == "name":
+				name = line[1]
+			elif key == "phase":
+				if fmt != 30:
+					raise ValueError("phase is only used by format 30")
+				if len(line) != 3:
+					raise ValueError("phase needs a length and a voltage string")
+				groups.append((int(line[1], 0), vs_val(line[2])))
+			elif key == "group":
+				if len(line) != 11:
+					raise ValueError("group needs 5 numbers and 5 voltage strings")
+				groups.append(([int(v, 0) for v in line[1:6]], [vs_val(s) for s in line[6:11]]))
+			elif key in ("volt", "frame"):
+				for item in line[1:]:
+					k, v = item.split("=")
+					kv[k] = int(v, 0)
+			else:
+				raise ValueError("unknown keyword " + key)
+		except (ValueError, IndexError) as e:
+			sys.exit("%s:%d: %s" % (path, ln, e))
+
+	lut = Lut.new(fmt, name)
+	if len(groups) > FORMATS[fmt]["phases"]:
+		sys.exit("%s: %d groups, format %d has %d" % (path, len(groups), fmt, FORMATS[fmt]["phases"]))
+	if fmt == 30:
+		for p, (tp, vs) in enumerate(groups):
+			lut.tp[p] = tp
+			lut.vs[p] = vs
+		if kv:
+			sys.exit("%s: format 30 has no volt/frame fields" % path)
+		return lut
+	for g, (tp, vs) in enumerate(groups):
+		lut.tp[g] = tp
+		for l in range(5):
+			lut.vs[l][g] = vs[l]
+	for k in lut.tail:
+		if k not in kv:
+			sys.exit("%s: missing %s" % (path, k))
+		lut.tail[k] = kv.pop(k)
+	if kv:
+		sys.exit("%s: unknown fields: %s" % (path, " ".join(kv)))
+	return lut
+
+
+def emit_c(lut):
+	if lut.fmt == 30:
+		data = lut.to_bytes()
+		out = ["u8 %s[30] = {" % lut.name]
+		for i in range(0, 30, 10):
+			out.append("    " + " ".join("0x%02x," % v for v in data[i:i+10]))
+		out.append("};")
+		return "\n".join(out)
+
+	n = FORMATS[lut.fmt]["phases"]
+	tail = FORMATS[lut.fmt]["tail"]
+	out = []
+	out.append("u8 %s[%d] = {" % (lut.name, FORMATS[lut.fmt]["array"]))
+	out.append("//  " + "  ".join("RP%d " % i for i in range(n)).rstrip())
+	for l in range(5):
+		out.append("    " + " ".join("0x%02x," % v for v in lut.vs[l]) + "  // LUT%d" % l)
+	out.append("")
+	for g in range(n):
+		out.append("    " + " ".join("0x%02x," % v for v in lut.tp[g]) + "  // Group%d" % g)
+	out.append("")
+	out.append("//\t" + "  ".join("%-4s" % k for k in tail).rstrip())
+	out.append("    " + " ".join("0x%02x," % lut.tail[k] for k in tail))
+	out.append("};")
+	return "\n".join(out)
+
+
+def emit_wave(lut):
+	out = []
+	out.append("format %d" % lut.fmt)
+	out.append("name   %s" % lut.name)
+	if lut.fmt == 30:
+		out.append("#      TP  VS")
+		last = max([p for p in range(20) if lut.tp[p] or lut.vs[p]] + [0])
+		for p in range(last+1):
+			out.append("phase  %2d  %s" % (lut.tp[p], vs_str(lut.vs[p])))
+		return "\n".join(out)
+	out.append("#      TPA TPB TPC TPD  RP  LUT0 LUT1 LUT2 LUT3 LUT4")
+	last = max([g for g in range(len(lut.tp)) if any(lut.tp[g]) or any(lut.vs[l][g] for l in range(5))] + [0])
+	for g in range(last+1):
+		t = lut.tp[g]
+		out.append("group  %3d %3d %3d %3d %3d  %s" % (t[0], t[1], t[2], t[3], t[4],
+			" ".join(vs_str(lut.vs[l][g]) for l in range(5))))
+	volt = [k for k in lut.tail if not k.startswith("FR")]
+	out.append("volt   " + " ".join("%s=0x%02x" % (k, lut.tail[k]) for k in volt))
+	out.append("frame  FR1=0x%02x FR2=0x%02x" % (lut.tail["FR1"], lut.tail["FR2"]))
+	return "\n".join(out)
+
+
+def report(lut, lines, tgate):
+	return "%-14s %3d bytes  %4d frames x %6.2f ms = %7.1f ms" % (
+		lut.name, lut.size(), lut.frames(), lut.frame_us(lines, tgate)/1000.0, lut.duration_ms(lines, tgate))
+
+
+##############################################################################
+
+def main():
+	ap = argparse.ArgumentParser(description="e-paper LUT checker / compiler")
+	sub = ap.add_subparsers(dest="cmd")
+
+	p = sub.add_parser("check", help="validate the LUT tables in a C file and estimate refresh time")
+	p.add_argument("file")
+	p.add_argument("--lines", type=int, default=212, help="gate lines of the panel (default 212)")
+	p.add_argument("--tgate", type=int, help="gate line time in us, overrides FR2")
+	p.add_argument("--max", action="append", default=[], metavar="NAME=MS", help="fail if NAME takes longer")
+
+	p = sub.add_parser("dump", help="convert a LUT table in a C file to a waveform description")
+	p.add_argument("file")
+	p.add_argument("name")
+
+	p = sub.add_parser("compile", help="compile a waveform description to a C table")
+	p.add_argument("file")
+	p.add_argument("--lines", type=int, default=212)
+
+	args = ap.parse_args()
+
+	if args.cmd == "check":
+		limits = {}
+		for item in args.max:
+			k, v = item.split("=")
+			limits[k] = float(v)
+		fail = 0
+		for name, (size, data) in sorted(c_tables(args.file).items()):
+			fmt = lut_format(name, size)
+			if fmt is None:
+				print("%-14s skipped (unknown format)" % name)
+				continue
+			try:
+				lut = Lut.from_bytes(fmt, name, data)
+			except ValueError as e:
+				print("ERROR", e)
+				fail = 1
+				continue
+			print(report(lut, args.lines, args.tgate))
+			err, warn = lut.check()
+			for e in warn:
+				print("    WARNING", e)
+			for e in err:
+				print("    ERROR", e)
+				fail = 1
+			ms = lut.duration_ms(args.lines, args.tgate)
+			if name in limits:
+				limit = limits.pop(name)
+				if ms > limit:
+					print("    ERROR slower than %.1f ms" % limit)
+					fail = 1
+		for name in limits:
+			print("ERROR %s not found" % name)
+			fail = 1
+		sys.exit(fail)
+
+	elif args.cmd == "dump":
+		print(emit_wave(c_lut(args.file, args.name)))
+
+	elif args.cmd == "compile":
+		lut = parse_wave(args.file)
+		err, warn = lut.check()
+		for e in warn:
+			print("WARNING", e, file=sys.stderr)
+		for e in err:
+			print("ERROR", e, file=sys.stderr)
+		print("// %.1f ms @ %d lines" % (lut.duration_ms(args.lines), args.lines))
+		print(emit_c(lut))
+		sys.exit(1 if err else 0)
+
+	else:
+		ap.print_help()
+
+
+if __name__ == "__main__":
+	main()